@@ -1,28 +1,37 @@
 #include "engine.h"
 
-Engine::Engine(int width, int height) {
+Engine::Engine(int width, int height, uint32_t* target) {
 
+#ifndef HEADLESS
     shader = util::load_shader("shaders/vertex.txt", "shaders/fragment.txt");
     glUseProgram(shader);
 
     glClearColor(0.0f, 0.0f, 0.0f, 1.0f);
+#endif
 
     this->width = width;
     this->height = height;
+    pixels = target;
+#ifndef HEADLESS
     screenMesh = new QuadModel;
+#endif
 
     create_color_buffer(width, height);
+    columns.resize(width);
 
 }
 
 Engine::~Engine() {
+#ifndef HEADLESS
     delete screenMesh;
     glDeleteTextures(1, &colorBuffer);
     glDeleteProgram(shader);
+#endif
 }
 
 void Engine::create_color_buffer(int width, int height) {
 
+#ifndef HEADLESS
     glGenTextures(1, &colorBuffer);
     glActiveTexture(GL_TEXTURE0);
     glBindTexture(GL_TEXTURE_2D, colorBuffer);
@@ -32,22 +41,27 @@ void Engine::create_color_buffer(int width, int height) {
     glTextureParameteri(colorBuffer, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
     glTextureParameteri(colorBuffer, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
     glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, width, height, 0, GL_RGBA, GL_UNSIGNED_BYTE, NULL);
+#endif
 
-    colorBufferMemory.resize(width * height);
+    //only back the framebuffer ourselves if the caller didn't
+    if (!pixels) {
+        colorBufferMemory.resize(width * height);
+        pixels = colorBufferMemory.data();
+    }
 
 }
 
 void Engine::clear_screen(uint32_t color) {
 
     for (int pixel = 0; pixel < width * height; ++pixel) {
-        colorBufferMemory[pixel] = color;
+        pixels[pixel] = color;
     }
 }
 
 void Engine::vertical_line(int x, int y1, int y2, uint32_t color){
 
     for (int y = y1; y <= y2; ++y) {
-        colorBufferMemory[y + height * x] = color;
+        pixels[y + height * x] = color;
     }
 }
 
@@ -55,13 +69,17 @@ void Engine::pset(int x, int y, glm::vec3 color) {
     uint8_t r = std::max(0, std::min(255, (int)(255 * color.x)));
     uint8_t g = std::max(0, std::min(255, (int)(255 * color.y)));
     uint8_t b = std::max(0, std::min(255, (int)(255 * color.z)));
-    colorBufferMemory[y + height * x] = (r << 24) + (g << 8) + (b << 16);
+    pixels[y + height * x] = (r << 24) + (g << 8) + (b << 16);
 }
 
 void Engine::render(Scene* scene) {
 
+    timings.begin(FramePhase::CLEAR);
     clear_screen(0);
+    timings.end(FramePhase::CLEAR);
 
+    //cast every column, then draw them all, so each phase is timed once
+    timings.begin(FramePhase::CAST);
     for (int x = 0; x < width; ++x)
     {
         float cameraX = 2 * x / (float)width - 1;
@@ -146,13 +164,23 @@ void Engine::render(Scene* scene) {
             color = color >> 1; 
         }
 
+        columns[x] = { drawStart, drawEnd, static_cast<uint32_t>(color) };
+    }
+    timings.end(FramePhase::CAST);
+
+    timings.begin(FramePhase::DRAW);
+    for (int x = 0; x < width; ++x) {
         //draw the pixels of the stripe as a vertical line
-        vertical_line(x, drawStart, drawEnd, color);
+        vertical_line(x, columns[x].drawStart, columns[x].drawEnd, columns[x].color);
     }
+    timings.end(FramePhase::DRAW);
 
+#ifndef HEADLESS
     draw_screen();
+#endif
 }
 
+#ifndef HEADLESS
 void Engine::draw_screen() {
 
     glUseProgram(shader);
@@ -160,10 +188,15 @@ void Engine::draw_screen() {
     glActiveTexture(GL_TEXTURE0);
     glBindTexture(GL_TEXTURE_2D, colorBuffer);
 
-    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, height, width, 0, GL_RGBA, GL_UNSIGNED_BYTE, colorBufferMemory.data());
+    timings.begin(FramePhase::UPLOAD);
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, height, width, 0, GL_RGBA, GL_UNSIGNED_BYTE, pixels);
+    timings.end(FramePhase::UPLOAD);
 
+    timings.begin(FramePhase::PRESENT);
     glBindVertexArray(screenMesh->VAO);
     glDrawArrays(GL_TRIANGLES, 0, 6);
     glFlush();
+    timings.end(FramePhase::PRESENT);
 
-}
\ No newline at end of file
+}
+#endif
\ No newline at end of file
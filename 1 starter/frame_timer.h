@@ -0,0 +1,40 @@
+#pragma once
+#include "config.h"
+
+enum class FramePhase {
+	INPUT, UPDATE, RENDER,
+	CLEAR, CAST, DRAW, UPLOAD, PRESENT,
+	COUNT
+};
+
+/*
+	Keeps the most recent durations of every frame phase in fixed size
+	ring buffers, in milliseconds. Recording never allocates, so it stays
+	on in every build.
+*/
+class FrameTimer {
+public:
+	static const int sampleCount = 512;
+	static const int phaseCount = static_cast<int>(FramePhase::COUNT);
+
+	FrameTimer();
+	static std::chrono::high_resolution_clock::time_point now();
+	static double milliseconds(std::chrono::high_resolution_clock::time_point from,
+		std::chrono::high_resolution_clock::time_point to);
+	void begin(FramePhase phase);
+	void end(FramePhase phase);
+	void record(FramePhase phase, double milliseconds);
+	void reset();
+
+	int samples(FramePhase phase);
+	double latest(FramePhase phase);
+	double average(FramePhase phase);
+	double worst(FramePhase phase);
+	static const char* name(FramePhase phase);
+	std::string summary();
+
+private:
+	std::array<std::array<float, sampleCount>, phaseCount> history;
+	std::array<int, phaseCount> head, count;
+	std::array<std::chrono::high_resolution_clock::time_point, phaseCount> started;
+};
\ No newline at end of file
@@ -135,14 +135,20 @@ void GameApp::mainLoop() {
 
 	while (nextAction == returnCode::CONTINUE) {
 
+		renderer->timings.begin(FramePhase::INPUT);
 		nextAction = processInput();
 		glfwPollEvents();
+		renderer->timings.end(FramePhase::INPUT);
 
 		//update
+		renderer->timings.begin(FramePhase::UPDATE);
 		scene->update(frameTime / 16.0f);
+		renderer->timings.end(FramePhase::UPDATE);
 
 		//draw
+		renderer->timings.begin(FramePhase::RENDER);
 		renderer->render(scene);
+		renderer->timings.end(FramePhase::RENDER);
 
 		calculateFrameRate();
 
@@ -163,7 +169,7 @@ void GameApp::calculateFrameRate() {
 	if (delta >= 1) {
 		int framerate{ std::max(1, int(numFrames / delta)) };
 		std::stringstream title;
-		title << "Running at " << framerate << " fps.";
+		title << "Running at " << framerate << " fps. " << renderer->timings.summary();
 		glfwSetWindowTitle(window, title.str().c_str());
 		lastTime = currentTime;
 		numFrames = -1;
@@ -1,8 +1,20 @@
 #include "config.h"
+#ifdef HEADLESS
+#include "benchmark.h"
+#else
 #include "game_app.h"
+#endif
 
+#ifdef HEADLESS
+int main() {
+
+	benchmark::write_json(std::cout, "simd_drawing", benchmark::run());
+	return 0;
+}
+#else
 int main() {
 	GameApp* myApp = new GameApp(800,600);
 	delete myApp;
 	return 0;
-}
\ No newline at end of file
+}
+#endif
\ No newline at end of file
@@ -1,28 +1,37 @@
 #include "engine.h"
 
-Engine::Engine(int width, int height) {
+Engine::Engine(int width, int height, uint32_t* target) {
 
+#ifndef HEADLESS
     shader = util::load_shader("shaders/vertex.txt", "shaders/fragment.txt");
     glUseProgram(shader);
 
     glClearColor(0.0f, 0.0f, 0.0f, 1.0f);
+#endif
 
     this->width = width;
     this->height = height;
+    pixels = target;
+#ifndef HEADLESS
     screenMesh = new QuadModel;
+#endif
 
     create_color_buffer(width, height);
+    columns.resize(width);
 
 }
 
 Engine::~Engine() {
+#ifndef HEADLESS
     delete screenMesh;
     glDeleteTextures(1, &colorBuffer);
     glDeleteProgram(shader);
+#endif
 }
 
 void Engine::create_color_buffer(int width, int height) {
 
+#ifndef HEADLESS
     glGenTextures(1, &colorBuffer);
     glActiveTexture(GL_TEXTURE0);
     glBindTexture(GL_TEXTURE_2D, colorBuffer);
@@ -32,8 +41,13 @@ void Engine::create_color_buffer(int width, int height) {
     glTextureParameteri(colorBuffer, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
     glTextureParameteri(colorBuffer, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
     glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, width, height, 0, GL_RGBA, GL_UNSIGNED_BYTE, NULL);
+#endif
 
-    colorBufferMemory.resize(width * height);
+    //only back the framebuffer ourselves if the caller didn't
+    if (!pixels) {
+        colorBufferMemory.resize(width * height);
+        pixels = colorBufferMemory.data();
+    }
 
 }
 
@@ -41,16 +55,16 @@ void Engine::clear_screen(uint32_t color) {
 
     __m256i colorSIMD = _mm256_set1_epi32(color);
     int blockCount = static_cast<int>(width * height / 8);
-    __m256i* blocks = (__m256i*) colorBufferMemory.data();
+    __m256i* blocks = (__m256i*) pixels;
 
     //SIMD as much as possible
     for (int block = 0; block < blockCount; ++block) {
-        blocks[block] = colorSIMD;
+        _mm256_storeu_si256(blocks + block, colorSIMD);
     }
 
     //set any remaining pixels individually
     for (int pixel = blockCount * 8; pixel < width * height; ++pixel) {
-        colorBufferMemory[pixel] = color;
+        pixels[pixel] = color;
     }
 }
 
@@ -58,7 +72,7 @@ void Engine::vertical_line(int x, int y1, int y2, uint32_t color){
 
     __m256i colorSIMD = _mm256_set1_epi32(color);
     int blockCount = static_cast<int>(width * height / 8);
-    __m256i* blocks = (__m256i*) colorBufferMemory.data();
+    __m256i* blocks = (__m256i*) pixels;
 
     //get block indices and padding
     int pixel1 = y1 + height * x;
@@ -73,16 +87,16 @@ void Engine::vertical_line(int x, int y1, int y2, uint32_t color){
 
     //bottom
     for (int y = y1; y <= y1 + padding1; ++y) {
-        colorBufferMemory[y + height * x] = color;
+        pixels[y + height * x] = color;
     }
 
     for (int block = block1; block < block2; ++block) {
-        blocks[block] = colorSIMD;
+        _mm256_storeu_si256(blocks + block, colorSIMD);
     }
 
     //top
     for (int y = y2 - padding2; y <= y2; ++y) {
-        colorBufferMemory[y + height * x] = color;
+        pixels[y + height * x] = color;
     }
 }
 
@@ -90,12 +104,14 @@ void Engine::pset(int x, int y, glm::vec3 color) {
     uint8_t r = std::max(0, std::min(255, (int)(255 * color.x)));
     uint8_t g = std::max(0, std::min(255, (int)(255 * color.y)));
     uint8_t b = std::max(0, std::min(255, (int)(255 * color.z)));
-    colorBufferMemory[y + height * x] = (r << 24) + (g << 8) + (b << 16);
+    pixels[y + height * x] = (r << 24) + (g << 8) + (b << 16);
 }
 
 void Engine::render(Scene* scene) {
 
+    timings.begin(FramePhase::CLEAR);
     clear_screen(0);
+    timings.end(FramePhase::CLEAR);
 
     const int blockCount = width / 8;
     const __m256 cameraForwardsX = _mm256_set1_ps(scene->player->forwards.x);
@@ -104,6 +120,9 @@ void Engine::render(Scene* scene) {
     const __m256 cameraRightY = _mm256_set1_ps(scene->player->right.y);
     __m256 screenXCoords = _mm256_setr_ps(0, 1, 2, 3, 4, 5, 6, 7);
     int x = 0;
+
+    //cast every packet, then draw them all, so each phase is timed once
+    timings.begin(FramePhase::CAST);
     for (int i = 0; i < blockCount; ++i) {
 
         //Orient the ray
@@ -134,15 +153,12 @@ void Engine::render(Scene* scene) {
                 _mm256_set1_ps(int(scene->player->position.y) + 1.0 - scene->player->position.y),
                 _mm256_set1_ps(scene->player->position.y - int(scene->player->position.y)), negativeMask));
 
-        __m256 perpWallDist = _mm256_setzero_ps();
-        __m256 hit = _mm256_setzero_ps();
         __m256 side = _mm256_setzero_ps();
-        __m256i colorBuffer = _mm256_set1_epi32(0);
+        __m256 hitMask = _mm256_setzero_ps();
+        __m256i materialIndex;
 
         //perform DDA
-        int done = 0;
-        while (done != 255) {
-            __m256 hitMask = _mm256_cmp_ps(hit, _mm256_setzero_ps(), _CMP_NEQ_UQ);
+        do {
             __m256 sideMask = _mm256_cmp_ps(sideDistX, sideDistY, _CMP_LT_OQ);
             sideDistX = _mm256_blendv_ps(_mm256_blendv_ps(sideDistX, _mm256_add_ps(sideDistX, deltaDistX), sideMask), sideDistX, hitMask);
             rayPosX = _mm256_blendv_ps(_mm256_blendv_ps(rayPosX, _mm256_add_ps(rayPosX, stepX), sideMask), rayPosX, hitMask);
@@ -150,36 +166,22 @@ void Engine::render(Scene* scene) {
             rayPosY = _mm256_blendv_ps(_mm256_blendv_ps(_mm256_add_ps(rayPosY, stepY), rayPosY, sideMask), rayPosY, hitMask);
 
             side = _mm256_blendv_ps(_mm256_blendv_ps(_mm256_set1_ps(1), _mm256_setzero_ps(), sideMask), side, hitMask);
-            for (int lane = 0; lane < 8; ++lane) {
-                if (done & (1 << lane)) {
-                    continue;
-                }
-
-                //Check if ray has hit a wall
-                int mapX = int(rayPosX.m256_f32[lane]);
-                int mapY = int(rayPosY.m256_f32[lane]);
-                int materialIndex = scene->worldMap[mapX][mapY];
-                if (materialIndex > 0) {
-
-                    //Record hit
-                    hit.m256_f32[lane] = 1;
-                    done |= 1 << lane;
-
-                    //Record depth
-                    perpWallDist.m256_f32[lane] =
-                        (side.m256_f32[lane] == 0) ? (sideDistX.m256_f32[lane] - deltaDistX.m256_f32[lane])
-                        : perpWallDist.m256_f32[lane] = (sideDistY.m256_f32[lane] - deltaDistY.m256_f32[lane]);
-
-                    //Record color
-                    int color = colors[materialIndex];
-                    //give x and y sides different brightness
-                    if (side.m256_f32[lane] != 0) {
-                        color = color >> 1;
-                    }
-                    colorBuffer.m256i_i32[lane] = color;
-                }
-            }
-        }
+
+            //Check if ray has hit a wall, all eight at once. Rays that
+            //already hit fetch the same wall again, so they stay hit.
+            __m256i mapIndex = _mm256_cvttps_epi32(_mm256_fmadd_ps(rayPosX, _mm256_set1_ps(24), rayPosY));
+            materialIndex = _mm256_i32gather_epi32(&scene->worldMap[0][0], mapIndex, 4);
+            hitMask = _mm256_castsi256_ps(_mm256_cmpgt_epi32(materialIndex, _mm256_setzero_si256()));
+        } while (_mm256_movemask_ps(hitMask) != 0xff);
+
+        //Record depth
+        __m256 sideYMask = _mm256_cmp_ps(side, _mm256_setzero_ps(), _CMP_NEQ_UQ);
+        __m256 perpWallDist = _mm256_blendv_ps(
+            _mm256_sub_ps(sideDistX, deltaDistX), _mm256_sub_ps(sideDistY, deltaDistY), sideYMask);
+
+        //Record color, giving x and y sides different brightness
+        __m256i color = _mm256_i32gather_epi32((const int*)colors, materialIndex, 4);
+        color = _mm256_blendv_epi8(color, _mm256_srai_epi32(color, 1), _mm256_castps_si256(sideYMask));
 
         //Calculate height of line to draw on screen
         const __m256 screenHeight = _mm256_set1_ps(height);
@@ -191,16 +193,34 @@ void Engine::render(Scene* scene) {
         __m256 drawEnd = _mm256_min_ps(_mm256_set1_ps(height - 1),
             _mm256_mul_ps(_mm256_set1_ps(0.5), _mm256_add_ps(screenHeight, lineHeight)));
 
+        //single lanes are only read once every ray is done. Vector
+        //members like m256_f32 only exist on MSVC, so go through memory.
+        alignas(32) int laneColor[8], laneDrawStart[8], laneDrawEnd[8];
+        _mm256_store_si256((__m256i*)laneColor, color);
+        _mm256_store_si256((__m256i*)laneDrawStart, _mm256_cvttps_epi32(drawStart));
+        _mm256_store_si256((__m256i*)laneDrawEnd, _mm256_cvttps_epi32(drawEnd));
+
         for (int lane = 0; lane < 8; ++lane) {
-            //draw the pixels of the stripe as a vertical line
-            vertical_line(x++, int(drawStart.m256_f32[lane]), int(drawEnd.m256_f32[lane]), colorBuffer.m256i_i32[lane]);
+            columns[x++] = { laneDrawStart[lane], laneDrawEnd[lane], static_cast<uint32_t>(laneColor[lane]) };
         }
+
         screenXCoords = _mm256_add_ps(screenXCoords, _mm256_set1_ps(8));
     }
+    timings.end(FramePhase::CAST);
 
+    timings.begin(FramePhase::DRAW);
+    for (int column = 0; column < x; ++column) {
+        //draw the pixels of the stripe as a vertical line
+        vertical_line(column, columns[column].drawStart, columns[column].drawEnd, columns[column].color);
+    }
+    timings.end(FramePhase::DRAW);
+
+#ifndef HEADLESS
     draw_screen();
+#endif
 }
 
+#ifndef HEADLESS
 void Engine::draw_screen() {
 
     glUseProgram(shader);
@@ -208,10 +228,15 @@ void Engine::draw_screen() {
     glActiveTexture(GL_TEXTURE0);
     glBindTexture(GL_TEXTURE_2D, colorBuffer);
 
-    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, height, width, 0, GL_RGBA, GL_UNSIGNED_BYTE, colorBufferMemory.data());
+    timings.begin(FramePhase::UPLOAD);
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, height, width, 0, GL_RGBA, GL_UNSIGNED_BYTE, pixels);
+    timings.end(FramePhase::UPLOAD);
 
+    timings.begin(FramePhase::PRESENT);
     glBindVertexArray(screenMesh->VAO);
     glDrawArrays(GL_TRIANGLES, 0, 6);
     glFlush();
+    timings.end(FramePhase::PRESENT);
 
-}
\ No newline at end of file
+}
+#endif
\ No newline at end of file
@@ -1,6 +1,8 @@
 #pragma once
+#ifndef HEADLESS
 #include <glad/glad.h>
 #include <GLFW/glfw3.h>
+#endif
 #include <vector>
 #include <array>
 #include <glm/glm.hpp>
@@ -8,6 +10,10 @@
 #include <glm/gtc/type_ptr.hpp>
 #include <glm/gtx/euler_angles.hpp>
 #include <cstdlib>
+#include <cstdint>
+#include <algorithm>
+#include <chrono>
 #include <sstream>
 #include <fstream>
-#include <iostream>
\ No newline at end of file
+#include <iostream>
+#include <immintrin.h>
\ No newline at end of file
@@ -1,17 +1,29 @@
 #pragma once
 #include "config.h"
 #include "scene.h"
+#include "frame_timer.h"
+#ifndef HEADLESS
 #include "shader.h"
 #include "quad_model.h"
+#endif
 #include <taskflow/taskflow.hpp>
+#include <atomic>
 
 struct FrameSize {
 	unsigned int width, height;
 };
 
+//a column's wall, cast first and drawn once its neighbours are cast too
+struct ColumnHit {
+	int drawStart, drawEnd;
+	uint32_t color;
+};
+
 class Engine {
 public:
-	Engine(int width, int height, Scene* scene);
+	//target: optional caller-owned buffer of width * height pixels,
+	//stored column by column. Defaults to colorBufferMemory.
+	Engine(int width, int height, Scene* scene, uint32_t* target = nullptr);
 	~Engine();
 
 	void render();
@@ -19,16 +31,28 @@ public:
 	void create_task_graph();
 	void render_region(int startX, int batchSize);
 	void vertical_line(int x, int y1, int y2, uint32_t color);
+#ifndef HEADLESS
 	void draw_screen();
+#endif
 	void pset(int x, int y, glm::vec3 color);
 	void clear_screen(uint32_t color);
 
 	Scene* scene;
 
-	unsigned int shader, width, height;
-	unsigned int colorBuffer;
+	unsigned int width, height;
 	std::vector<uint32_t> colorBufferMemory;
+	uint32_t* pixels;
+#ifndef HEADLESS
+	unsigned int shader;
+	unsigned int colorBuffer;
 	QuadModel* screenMesh;
+#endif
+
+	FrameTimer timings;
+	std::vector<ColumnHit> columns;
+	//cast and draw time summed over every worker, so together they can
+	//exceed the wall time of the frame
+	std::atomic<long long> castNanoseconds, drawNanoseconds;
 
 	uint32_t colors[6] = {
 		static_cast <uint32_t>(0),
@@ -0,0 +1,136 @@
+#include "benchmark.h"
+#include "engine.h"
+
+static const int warmupFrames = 30;
+static const int measuredFrames = 300;
+
+std::vector<CameraPath> benchmark::camera_paths() {
+
+	//positions are in map cells, yaw in degrees. Every path stays clear of walls.
+	return {
+		{"spin", {
+			{{22.5f, 12.5f, 0.0f}, 0.0f},
+			{{22.5f, 12.5f, 0.0f}, 360.0f}}},
+		{"corridor", {
+			{{22.5f, 12.5f, 0.0f}, 180.0f},
+			{{1.5f, 12.5f, 0.0f}, 180.0f}}},
+		{"room", {
+			{{18.5f, 3.5f, 0.0f}, 360.0f},
+			{{18.5f, 3.5f, 0.0f}, 0.0f}}},
+		{"strafe", {
+			{{12.5f, 2.5f, 0.0f}, 0.0f},
+			{{12.5f, 21.5f, 0.0f}, 0.0f}}}
+	};
+}
+
+void benchmark::move_camera(Scene* scene, const CameraPath& path, int frame, int frameCount) {
+
+	//linear interpolation between evenly spaced keyframes
+	float t = static_cast<float>(frame) / std::max(1, frameCount - 1)
+		* (path.keyframes.size() - 1);
+	int segment = std::min(static_cast<int>(t), static_cast<int>(path.keyframes.size()) - 2);
+	float blend = t - segment;
+	const CameraKeyframe& a = path.keyframes[segment];
+	const CameraKeyframe& b = path.keyframes[segment + 1];
+
+	scene->player->position = glm::mix(a.position, b.position, blend);
+	scene->player->eulers = { 0.0f, 90.0f, glm::mix(a.yaw, b.yaw, blend) };
+	scene->update(1.0f);
+}
+
+BenchmarkResult benchmark::summarize(const char* path, int width, int height, std::vector<double>& frameTimes) {
+
+	std::sort(frameTimes.begin(), frameTimes.end());
+	int frames = static_cast<int>(frameTimes.size());
+
+	double total = 0.0;
+	for (double frameTime : frameTimes) {
+		total += frameTime;
+	}
+
+	//nearest-rank percentiles
+	BenchmarkResult result;
+	result.path = path;
+	result.width = width;
+	result.height = height;
+	result.frames = frames;
+	result.meanTime = total / frames;
+	result.medianTime = frameTimes[(frames + 1) / 2 - 1];
+	result.p99Time = frameTimes[(99 * frames + 99) / 100 - 1];
+	result.maxTime = frameTimes.back();
+	return result;
+}
+
+std::vector<BenchmarkResult> benchmark::run() {
+
+	std::vector<std::array<int, 2>> resolutions = { {800, 600}, {1280, 720}, {1920, 1080} };
+	std::vector<CameraPath> paths = camera_paths();
+	std::vector<BenchmarkResult> results;
+
+	for (std::array<int, 2> resolution : resolutions) {
+
+		Scene* scene = new Scene();
+		Engine* renderer = new Engine(resolution[0], resolution[1], scene);
+
+		for (const CameraPath& path : paths) {
+
+			std::vector<double> frameTimes;
+			for (int frame = 0; frame < warmupFrames + measuredFrames; ++frame) {
+
+				int step = std::max(0, frame - warmupFrames);
+				move_camera(scene, path, step, measuredFrames);
+
+				auto start = std::chrono::high_resolution_clock::now();
+				renderer->render();
+				std::chrono::duration<double, std::milli> elapsed = std::chrono::high_resolution_clock::now() - start;
+
+				if (frame >= warmupFrames) {
+					frameTimes.push_back(elapsed.count());
+				}
+				else if (frame == warmupFrames - 1) {
+					renderer->timings.reset();
+				}
+			}
+
+			BenchmarkResult result = summarize(path.name, resolution[0], resolution[1], frameTimes);
+			for (int i = 0; i < FrameTimer::phaseCount; ++i) {
+				result.phaseTimes[i] = renderer->timings.average(static_cast<FramePhase>(i));
+			}
+			results.push_back(result);
+		}
+
+		delete renderer;
+		delete scene;
+	}
+
+	return results;
+}
+
+void benchmark::write_json(std::ostream& out, const char* backend, const std::vector<BenchmarkResult>& results) {
+
+	out << "{\n  \"backend\": \"" << backend << "\",\n  \"results\": [\n";
+	for (size_t i = 0; i < results.size(); ++i) {
+		const BenchmarkResult& result = results[i];
+		out << "    {\"path\": \"" << result.path << "\""
+			<< ", \"width\": " << result.width
+			<< ", \"height\": " << result.height
+			<< ", \"frames\": " << result.frames
+			<< ", \"mean_ms\": " << result.meanTime
+			<< ", \"p50_ms\": " << result.medianTime
+			<< ", \"p99_ms\": " << result.p99Time
+			<< ", \"max_ms\": " << result.maxTime
+			<< ", \"phases_ms\": {";
+		bool firstPhase = true;
+		for (int phase = 0; phase < FrameTimer::phaseCount; ++phase) {
+			if (result.phaseTimes[phase] <= 0.0) {
+				continue;
+			}
+			out << (firstPhase ? "" : ", ") << "\"" << FrameTimer::name(static_cast<FramePhase>(phase))
+				<< "\": " << result.phaseTimes[phase];
+			firstPhase = false;
+		}
+		out << "}}"
+			<< ((i + 1 < results.size()) ? ",\n" : "\n");
+	}
+	out << "  ]\n}\n";
+}
\ No newline at end of file
@@ -8,6 +8,9 @@
 #include <glm/gtc/type_ptr.hpp>
 #include <glm/gtx/euler_angles.hpp>
 #include <cstdlib>
+#include <cstdint>
+#include <algorithm>
+#include <chrono>
 #include <sstream>
 #include <fstream>
 #include <iostream>
\ No newline at end of file
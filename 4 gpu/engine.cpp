@@ -1,6 +1,6 @@
 #include "engine.h"
 
-Engine::Engine(int width, int height, Scene* scene) {
+Engine::Engine(int width, int height, Scene* scene, uint32_t* target) {
 
     raycastDrawShader = util::load_shader("shaders/raycast_vertex.txt", "shaders/raycast_geometry.txt", "shaders/raycast_fragment.txt");
     raycastComputeShader = util::load_shader("shaders/raycast_compute.txt");
@@ -10,13 +10,22 @@ Engine::Engine(int width, int height, Scene* scene) {
     this->width = width;
     this->height = height;
     this->scene = scene;
+    pixels = target;
     glGenVertexArrays(1, &dummyVAO);
 
     create_resources();
+#ifdef HEADLESS
+    create_offscreen_target();
+#endif
 
 }
 
 Engine::~Engine() {
+#ifdef HEADLESS
+    glDeleteFramebuffers(1, &offscreenFramebuffer);
+    glDeleteTextures(1, &offscreenColorBuffer);
+#endif
+    glDeleteQueries(queryFrames * 3, &timestampQueries[0][0]);
     glDeleteVertexArrays(1, &dummyVAO);
     glDeleteProgram(raycastDrawShader);
     glDeleteProgram(raycastComputeShader);
@@ -50,13 +59,57 @@ void Engine::create_resources() {
 
     glUseProgram(raycastComputeShader);
     glUniform2i(glGetUniformLocation(raycastComputeShader, "mapSize"), 24, 24);
+    glUniform1i(glGetUniformLocation(raycastComputeShader, "screenWidth"), width);
     cameraPosLocation = glGetUniformLocation(raycastComputeShader, "cameraPos");
     cameraForwardsLocation = glGetUniformLocation(raycastComputeShader, "cameraForwards");
     cameraRightLocation = glGetUniformLocation(raycastComputeShader, "cameraRight");
+
+    glUseProgram(raycastDrawShader);
+    glUniform1i(glGetUniformLocation(raycastDrawShader, "screenWidth"), width);
+
+    //timestamps
+    glGenQueries(queryFrames * 3, &timestampQueries[0][0]);
+    queryFrame = 0;
+}
+
+void Engine::collect_gpu_timings(int slot) {
+
+    //never stall the pipeline for a measurement
+    int available = 0;
+    glGetQueryObjectiv(timestampQueries[slot][2], GL_QUERY_RESULT_AVAILABLE, &available);
+    if (!available) {
+        return;
+    }
+
+    GLuint64 timestamps[3];
+    for (int i = 0; i < 3; ++i) {
+        glGetQueryObjectui64v(timestampQueries[slot][i], GL_QUERY_RESULT, &timestamps[i]);
+    }
+    timings.record(FramePhase::CAST, (timestamps[1] - timestamps[0]) * 1e-6);
+    timings.record(FramePhase::DRAW, (timestamps[2] - timestamps[1]) * 1e-6);
 }
 
+#ifdef HEADLESS
+void Engine::create_offscreen_target() {
+
+    //nothing is presented, so draw into a texture instead of the window
+    glCreateTextures(GL_TEXTURE_2D, 1, &offscreenColorBuffer);
+    glTextureStorage2D(offscreenColorBuffer, 1, GL_RGBA8, width, height);
+
+    glCreateFramebuffers(1, &offscreenFramebuffer);
+    glNamedFramebufferTexture(offscreenFramebuffer, GL_COLOR_ATTACHMENT0, offscreenColorBuffer, 0);
+}
+#endif
+
 void Engine::render() {
 
+    int slot = queryFrame % queryFrames;
+    if (queryFrame >= queryFrames) {
+        collect_gpu_timings(slot);
+    }
+    ++queryFrame;
+
+    glQueryCounter(timestampQueries[slot][0], GL_TIMESTAMP);
     glUseProgram(raycastComputeShader);
     glUniform3fv(cameraPosLocation, 1, glm::value_ptr(scene->player->position));
     glUniform3fv(cameraForwardsLocation, 1, glm::value_ptr(scene->player->forwards));
@@ -65,10 +118,20 @@ void Engine::render() {
     unsigned int workgroup_count = (width + 63) / 64;
     glDispatchCompute(workgroup_count, 1, 1);
     glMemoryBarrier(GL_SHADER_STORAGE_BARRIER_BIT);
+    glQueryCounter(timestampQueries[slot][1], GL_TIMESTAMP);
 
+#ifdef HEADLESS
+    glBindFramebuffer(GL_FRAMEBUFFER, offscreenFramebuffer);
+#endif
     glClear(GL_COLOR_BUFFER_BIT);
     glUseProgram(raycastDrawShader);
     glBindVertexArray(dummyVAO);
     glDrawArraysInstanced(GL_POINTS, 0, 1, width);
+    glQueryCounter(timestampQueries[slot][2], GL_TIMESTAMP);
+#ifdef HEADLESS
+    if (pixels) {
+        glReadPixels(0, 0, width, height, GL_RGBA, GL_UNSIGNED_BYTE, pixels);
+    }
+#endif
     glFlush();
 }
\ No newline at end of file
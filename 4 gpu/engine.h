@@ -1,6 +1,7 @@
 #pragma once
 #include "config.h"
 #include "scene.h"
+#include "frame_timer.h"
 #include "shader.h"
 
 struct FrameSize {
@@ -9,11 +10,17 @@ struct FrameSize {
 
 class Engine {
 public:
-	Engine(int width, int height, Scene* scene);
+	//target: optional caller-owned buffer of width * height pixels.
+	//Headless builds read every frame back into it, row by row.
+	Engine(int width, int height, Scene* scene, uint32_t* target = nullptr);
 	~Engine();
 
 	void render();
 	void create_resources();
+	void collect_gpu_timings(int slot);
+#ifdef HEADLESS
+	void create_offscreen_target();
+#endif
 
 
 	unsigned int raycastComputeShader, raycastDrawShader;
@@ -26,6 +33,18 @@ public:
 	unsigned int dummyVAO;
 	Scene* scene;
 
+	//gpu work finishes frames after it's submitted, so timestamps go
+	//round a ring of queries and are read back once they're available
+	static const int queryFrames = 4;
+	unsigned int timestampQueries[queryFrames][3];
+	int queryFrame;
+	FrameTimer timings;
+
+	uint32_t* pixels;
+#ifdef HEADLESS
+	unsigned int offscreenFramebuffer, offscreenColorBuffer;
+#endif
+
 	std::vector<glm::vec4> colors = { glm::vec4(0.0f),
 		glm::vec4(0.0f, 0.0f, 0.5f, 1.0f), glm::vec4(0.0f, 0.5f, 0.0f, 1.0f),
 		glm::vec4(0.0f, 0.5f, 0.5f, 1.0f), glm::vec4(0.5f, 0.0f, 0.0f, 1.0f),
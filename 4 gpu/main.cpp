@@ -1,8 +1,46 @@
 #include "config.h"
+#ifdef HEADLESS
+#include "benchmark.h"
+#else
 #include "game_app.h"
+#endif
 
+#ifdef HEADLESS
+int main() {
+
+	//compute and draw still need a context, but the window is never shown
+	if (!glfwInit()) {
+		std::cerr << "Couldn't start GLFW" << std::endl;
+		return 1;
+	}
+	glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 4);
+	glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 5);
+	glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
+	glfwWindowHint(GLFW_VISIBLE, GLFW_FALSE);
+	GLFWwindow* window = glfwCreateWindow(800, 600, "Headless", NULL, NULL);
+	if (!window) {
+		//there's no surfaceless context here, so without a display the
+		//gpu work has nowhere to run
+		std::cerr << "Couldn't create an OpenGL 4.5 context" << std::endl;
+		glfwTerminate();
+		return 1;
+	}
+	glfwMakeContextCurrent(window);
+	if (!gladLoadGLLoader((GLADloadproc)glfwGetProcAddress)) {
+		std::cerr << "Couldn't load OpenGL functions" << std::endl;
+		glfwTerminate();
+		return 1;
+	}
+
+	benchmark::write_json(std::cout, "gpu", benchmark::run());
+
+	glfwTerminate();
+	return 0;
+}
+#else
 int main() {
 	GameApp* myApp = new GameApp(800,600);
 	delete myApp;
 	return 0;
-}
\ No newline at end of file
+}
+#endif
\ No newline at end of file
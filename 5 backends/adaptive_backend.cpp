@@ -0,0 +1,342 @@
+#include "adaptive_backend.h"
+
+//further than any ray can reach, for the axis a closed form jump ignores
+static const int unlimitedReach = 1 << 20;
+
+//Crossings a ray makes on the other axis before its crossing number i on
+//the face's axis. Ties go to y, as in FixedRay::step.
+static int64_t crossings_before(const FixedRay& ray, int side, int64_t i) {
+
+    if (side == 0) {
+        int64_t crossing = ray.sideDistX + i * ray.deltaDistX;
+        return crossing < ray.sideDistY ? 0 : (crossing - ray.sideDistY) / ray.deltaDistY + 1;
+    }
+    int64_t crossing = ray.sideDistY + i * ray.deltaDistY;
+    return crossing <= ray.sideDistX ? 0 : (crossing - ray.sideDistX - 1) / ray.deltaDistX + 1;
+}
+
+//where ray stops, given it crosses onto face's face with nothing in
+//the way: every crossing before that one, then the one onto it
+static FixedRay land(FixedRay ray, const FixedRay& face) {
+
+    if (face.side == 0) {
+        ray.jump(std::abs(face.mapX - ray.mapX) - 1, unlimitedReach);
+    }
+    else {
+        ray.jump(unlimitedReach, std::abs(face.mapY - ray.mapY) - 1);
+    }
+    ray.step();
+    return ray;
+}
+
+//positive when b is anticlockwise of a
+static int64_t turn(const FixedRay& a, const FixedRay& b) {
+    return static_cast<int64_t>(a.rayDirX) * b.rayDirY - static_cast<int64_t>(a.rayDirY) * b.rayDirX;
+}
+
+Wedge::Wedge(const MapGrid& map, const FixedRay& rayA, const FixedRay& hitA,
+    const FixedRay& rayB, const FixedRay& hitB, bool sameCamera) {
+
+    //both on the same face, heading the same way
+    side = hitA.side;
+    stepX = rayA.stepX;
+    stepY = rayA.stepY;
+    if (hitB.side != side || rayB.stepX != stepX || rayB.stepY != stepY) {
+        return;
+    }
+    if (side == 0 ? hitA.mapX != hitB.mapX : hitA.mapY != hitB.mapY) {
+        return;
+    }
+
+    //Through one camera, both rays' deltas change monotonically across
+    //the gap, and when one grows as the other shrinks every ray between
+    //crosses each strip between where the outer two do
+    bool sameWay = (rayA.deltaDistX < rayB.deltaDistX && rayA.deltaDistY < rayB.deltaDistY)
+        || (rayA.deltaDistX > rayB.deltaDistX && rayA.deltaDistY > rayB.deltaDistY);
+    bool slack = !sameCamera || sameWay;
+
+    //Open floor is where rays don't stop, so not the open edge of the
+    //map. Off the map counts as neither.
+    auto cell_is = [&](int64_t strip, int64_t across, bool wall) {
+        int x = rayA.mapX + stepX * static_cast<int>(side == 0 ? strip : across);
+        int y = rayA.mapY + stepY * static_cast<int>(side == 0 ? across : strip);
+        if (x < 0 || x >= map.width || y < 0 || y >= map.height) {
+            return false;
+        }
+        return wall ? map.solid(x, y) : !map.stops(x, y);
+    };
+
+    //a ray crosses the face's axis faceCrossings times, the last onto
+    //the face. Between its crossings number i - 1 and i it walks the
+    //cells from crossings_before(i - 1) to crossings_before(i) across.
+    int64_t faceCrossings = side == 0 ? std::abs(hitA.mapX - rayA.mapX) : std::abs(hitA.mapY - rayA.mapY);
+    int64_t lastA = 0, lastB = 0;
+    for (int64_t strip = 0; strip <= faceCrossings; ++strip) {
+
+        //the cells across the strip where the face is must be wall
+        bool face = strip == faceCrossings;
+        int64_t nextA = face ? lastA : crossings_before(rayA, side, strip);
+        int64_t nextB = face ? lastB : crossings_before(rayB, side, strip);
+        int64_t low = strip == 0 ? 0 : std::min(lastA, lastB);
+        int64_t high = std::max(nextA, nextB);
+        for (int64_t across = low; across <= high; ++across) {
+            if (!cell_is(strip, across, face)) {
+                return;
+            }
+        }
+
+        //one cell further either side
+        if (slack) {
+            if (low > 0 && !cell_is(strip, low - 1, face)) {
+                bound(strip - 1, low, false);
+            }
+            if (!cell_is(strip, high + 1, face)) {
+                bound(face ? strip - 1 : strip, high, true);
+            }
+            if (boundCount > maxBounds) {
+                return;
+            }
+        }
+        lastA = nextA;
+        lastB = nextB;
+    }
+    clear = true;
+}
+
+void Wedge::bound(int64_t strip, int64_t limit, bool upper) {
+
+    if (boundCount < maxBounds) {
+        bounds[boundCount] = { strip, limit, upper };
+    }
+    ++boundCount;
+}
+
+bool Wedge::admits(const FixedRay& ray) const {
+
+    if (!clear || ray.stepX != stepX || ray.stepY != stepY) {
+        return false;
+    }
+    for (int i = 0; i < boundCount; ++i) {
+        const Bound& bound = bounds[i];
+        int64_t crossings = crossings_before(ray, side, bound.strip);
+        if (bound.upper ? crossings > bound.limit : crossings < bound.limit) {
+            return false;
+        }
+    }
+    return true;
+}
+
+AngularCache::AngularCache() {
+    bins.resize(binCount);
+}
+
+void AngularCache::validate(const FixedCamera& camera, const MapGrid& map) {
+
+    if (camera.positionX == positionX && camera.positionY == positionY
+        && &map == this->map && map.revision == revision) {
+        return;
+    }
+    positionX = camera.positionX;
+    positionY = camera.positionY;
+    this->map = &map;
+    revision = map.revision;
+    ++generation;
+    filledCount = 0;
+}
+
+//Bins only need to keep rays roughly in order, find checks the actual
+//order itself. The diamond angle, 0 to 4 around the circle, does that
+//without any trigonometry.
+static int bin_of(const FixedRay& ray, int binCount) {
+    float x = static_cast<float>(ray.rayDirX), y = static_cast<float>(ray.rayDirY);
+    float angle;
+    if (y >= 0) {
+        angle = x >= 0 ? y / (x + y) : 1 - x / (y - x);
+    }
+    else {
+        angle = x < 0 ? 2 - y / (-x - y) : 3 + x / (x - y);
+    }
+    int bin = static_cast<int>(angle * (binCount / 4));
+    return std::min(std::max(bin, 0), binCount - 1);
+}
+
+bool AngularCache::find(const MapGrid& map, const FixedRay& aimed, FixedRay& hit) {
+
+    if (filledCount == 0) {
+        return false;
+    }
+
+    //the nearest filled bin at or before the ray's, and the one after
+    //it. Either could turn out to be the upper one of the pair.
+    int bin = bin_of(aimed, binCount);
+    int lower = -1, upper = -1;
+    for (int i = 0; i < searchBins && lower < 0; ++i) {
+        int candidate = (bin - i) & (binCount - 1);
+        if (!filled(candidate)) {
+            continue;
+        }
+        if (upper < 0 && turn(bins[candidate].aimed, aimed) < 0) {
+            upper = candidate;
+        }
+        else {
+            lower = candidate;
+        }
+    }
+    if (lower < 0) {
+        return false;
+    }
+    for (int i = 1; i <= searchBins && upper < 0; ++i) {
+        int candidate = (lower + i) & (binCount - 1);
+        if (filled(candidate)) {
+            upper = candidate;
+        }
+    }
+    if (upper < 0 || upper == lower) {
+        return false;
+    }
+
+    //the ray must really lie between them
+    Entry& below = bins[lower];
+    const Entry& above = bins[upper];
+    if (turn(below.aimed, aimed) < 0 || turn(aimed, above.aimed) < 0) {
+        return false;
+    }
+
+    if (below.checkedUpTo != upper) {
+        below.checkedUpTo = upper;
+        below.wedge = Wedge(map, below.aimed, below.hit, above.aimed, above.hit, false);
+    }
+    if (!below.wedge.admits(aimed)) {
+        return false;
+    }
+    hit = land(aimed, below.hit);
+    return true;
+}
+
+void AngularCache::store(const FixedRay& aimed, const FixedRay& hit) {
+
+    int bin = bin_of(aimed, binCount);
+    if (filled(bin)) {
+        return;
+    }
+    Entry& entry = bins[bin];
+    entry.generation = generation;
+    entry.aimed = aimed;
+    entry.hit = hit;
+    entry.checkedUpTo = -1;
+    ++filledCount;
+}
+
+AdaptiveBackend::AdaptiveBackend() {
+    drawAvx2 = simd::supported(SimdIsa::AVX2);
+}
+
+void AdaptiveBackend::render(Scene* scene, Framebuffer& framebuffer, FrameTimer& timings) {
+
+    const int width = framebuffer.width;
+    columns.resize(width);
+
+    timings.begin(FramePhase::CAST);
+    if (precision == DdaPrecision::FIXED) {
+        cast_adaptive(scene, width, framebuffer.height);
+    }
+    else {
+        for (int x = 0; x < width; ++x) {
+            columns[x] = raycast::cast_column(scene, x, width, framebuffer.height);
+        }
+        raysCast = width;
+    }
+    timings.end(FramePhase::CAST);
+
+    timings.begin(FramePhase::DRAW);
+    for (int x = 0; x < width; ++x) {
+        drawing::draw_column(framebuffer, x, columns[x], drawAvx2);
+    }
+    drawing::finish_columns(framebuffer);
+    timings.end(FramePhase::DRAW);
+}
+
+void AdaptiveBackend::cast_adaptive(Scene* scene, int width, int height) {
+
+    this->height = height;
+    aimed.resize(width);
+    hit.resize(width);
+    cached.resize(width);
+    raysCast = 0;
+
+    camera = FixedCamera(scene);
+    for (int x = 0; x < width; ++x) {
+        aimed[x].aim(camera, x, width);
+    }
+    const MapGrid& map = scene->map;
+    cache.validate(camera, map);
+
+    //rays cast from here on earlier frames often settle most columns
+    for (int x = 0; x < width; ++x) {
+        cached[x] = cache.find(map, aimed[x], hit[x]);
+    }
+
+    //the last column is always cast, so every gap has an end
+    cast(map, 0);
+    for (int a = 0; a < width - 1; a += stride) {
+        int b = std::min(a + stride, width - 1);
+        cast(map, b);
+        fill(map, a, b);
+    }
+
+    for (int x = 0; x < width; ++x) {
+        cache.store(aimed[x], hit[x]);
+    }
+}
+
+void AdaptiveBackend::cast(const MapGrid& map, int x) {
+
+    FixedRay& ray = hit[x];
+    if (!cached[x]) {
+        ray = aimed[x];
+        ray.walk(map, camera.maxDistance);
+        ++raysCast;
+    }
+    columns[x] = ray.resolve(map, camera, height);
+}
+
+void AdaptiveBackend::fill(const MapGrid& map, int a, int b) {
+
+    if (b - a < 2) {
+        return;
+    }
+
+    bool allCached = true;
+    for (int x = a + 1; x < b; ++x) {
+        allCached = allCached && cached[x];
+    }
+    if (allCached) {
+        for (int x = a + 1; x < b; ++x) {
+            columns[x] = hit[x].resolve(map, camera, height);
+        }
+        return;
+    }
+
+    Wedge wedge(map, aimed[a], hit[a], aimed[b], hit[b], true);
+    if (!wedge.clear) {
+        int middle = (a + b) / 2;
+        cast(map, middle);
+        fill(map, a, middle);
+        fill(map, middle, b);
+        return;
+    }
+
+    //every ray between the wedge admits crosses onto the same face
+    for (int x = a + 1; x < b; ++x) {
+        if (cached[x]) {
+            columns[x] = hit[x].resolve(map, camera, height);
+        }
+        else if (wedge.admits(aimed[x])) {
+            hit[x] = land(aimed[x], hit[a]);
+            columns[x] = hit[x].resolve(map, camera, height);
+        }
+        else {
+            cast(map, x);
+        }
+    }
+}
\ No newline at end of file
@@ -0,0 +1,138 @@
+#pragma once
+#include "backend.h"
+
+/*
+	What a ray needs to land where two others from the same spot do, on
+	one face with only open floor before it.
+
+	Cells are numbered by how many crossings a ray has made along the
+	face's axis (its strip) and along the other axis. The cells every
+	ray between could walk through are checked empty and the cells they
+	could end in are checked wall. Rays aimed through one camera where
+	one delta grows as the other shrinks always cross between the outer
+	two, anywhere else rounding can put a ray between one cell past
+	them. Where that next cell over isn't what's needed, the wedge
+	instead keeps a bound on where rays may cross that strip, and
+	admits checks each ray against them.
+*/
+struct Wedge {
+	Wedge() {}
+	Wedge(const MapGrid& map, const FixedRay& rayA, const FixedRay& hitA,
+		const FixedRay& rayB, const FixedRay& hitB, bool sameCamera);
+
+	//will ray, between the two, land on their face?
+	bool admits(const FixedRay& ray) const;
+
+	struct Bound {
+		int64_t strip;
+		int64_t limit;
+		bool upper;
+	};
+	static const int maxBounds = 8;
+
+	bool clear = false;
+	int side = 0;
+	int stepX = 0, stepY = 0;
+	Bound bounds[maxBounds];
+	int boundCount = 0;
+
+private:
+	void bound(int64_t strip, int64_t limit, bool upper);
+};
+
+/*
+	Rays already cast from where the camera stands, by the angle they
+	left it at.
+
+	When the camera only turns, a ray aimed this frame usually lands
+	between two rays that were cast on earlier frames. If those two hit
+	the same face and the wedge between them admits it, this one hits it
+	too, and its hit follows in closed form as in AdaptiveBackend::fill.
+	Each bin keeps the first ray that fell into it, and the wedge from
+	it to the next filled bin, so a turning camera mostly reuses checks
+	it has already made.
+
+	Everything is dropped as soon as the camera moves or the map
+	changes.
+*/
+class AngularCache {
+public:
+	AngularCache();
+	//forget everything unless the camera and map are as they were
+	void validate(const FixedCamera& camera, const MapGrid& map);
+	//where aimed would stop, if rays already cast show the way
+	bool find(const MapGrid& map, const FixedRay& aimed, FixedRay& hit);
+	//remember where aimed stopped
+	void store(const FixedRay& aimed, const FixedRay& hit);
+
+private:
+	static const int binShift = 12;
+	static const int binCount = 1 << binShift;
+	//how far either side of its bin a ray looks for company
+	static const int searchBins = 16;
+
+	struct Entry {
+		//filled on this generation
+		int generation = 0;
+		FixedRay aimed, hit;
+		//the wedge up to the next filled bin, and which bin that was
+		int checkedUpTo = -1;
+		Wedge wedge;
+	};
+	std::vector<Entry> bins;
+	int generation = 1;
+	int filledCount = 0;
+
+	int32_t positionX = 0, positionY = 0;
+	const MapGrid* map = nullptr;
+	int revision = -1;
+
+	bool filled(int bin) const { return bins[bin].generation == generation; }
+};
+
+/*
+	Casts only some columns in full and works the rest out from them.
+
+	Every stride-th column is cast. When two cast columns hit the same
+	face of the map, the columns between usually do too, and then each
+	one's hit follows in closed form from its own setup: one exact
+	FixedRay::jump up to the face and a last step onto it. That's only
+	trusted once the Wedge between the two rays admits it. Where the
+	wedge isn't clear, the middle column is cast and both halves are
+	tried again, so rays are only spent around edges. Columns that are cast look in an AngularCache first, so
+	frames where the camera only turns barely walk at all.
+
+	The closed form lands exactly where stepping does only because
+	fixed point side distances add up exactly, so this only happens with
+	DdaPrecision::FIXED and then matches cast_column_fixed everywhere.
+	With floats every column is cast.
+*/
+class AdaptiveBackend : public Backend {
+public:
+	AdaptiveBackend();
+	void render(Scene* scene, Framebuffer& framebuffer, FrameTimer& timings) override;
+
+	//columns walked in full on the last frame
+	int raysCast = 0;
+
+private:
+	void cast_adaptive(Scene* scene, int width, int height);
+	//cast column x in full
+	void cast(const MapGrid& map, int x);
+	//fill in the columns strictly between cast columns a and b
+	void fill(const MapGrid& map, int a, int b);
+
+	static const int stride = 8;
+
+	bool drawAvx2;
+
+	//each column's ray as aimed, and where it stopped
+	std::vector<FixedRay> aimed, hit;
+	//columns the cache settled before anything was cast
+	std::vector<bool> cached;
+	std::vector<ColumnHit> columns;
+	FixedCamera camera;
+	int height = 0;
+
+	AngularCache cache;
+};
\ No newline at end of file
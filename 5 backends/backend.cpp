@@ -0,0 +1,111 @@
+#include "backend.h"
+#include "environment.h"
+#include "column_backend.h"
+#include "simd_rays_backend.h"
+#include "taskflow_backend.h"
+#include "adaptive_backend.h"
+#ifndef HEADLESS
+#include "gpu_backend.h"
+#endif
+
+const char* backends::name(BackendType type) {
+    switch (type) {
+    case BackendType::SCALAR:
+        return "scalar";
+    case BackendType::SIMD_DRAWING:
+        return "simd_drawing";
+    case BackendType::SIMD_RAYS:
+        return "simd_rays";
+    case BackendType::SIMD_STREAM:
+        return "simd_stream";
+    case BackendType::TASKFLOW_BATCHED:
+        return "taskflow_batched";
+    case BackendType::TASKFLOW_PARALLEL_FOR:
+        return "taskflow_parallel_for";
+    case BackendType::TASKFLOW_SIMD:
+        return "taskflow_simd";
+    case BackendType::GPU:
+        return "gpu";
+    case BackendType::ADAPTIVE:
+        return "adaptive";
+    default:
+        return "unknown";
+    }
+}
+
+BackendType backends::from_name(const std::string& name) {
+    for (int i = 0; i < static_cast<int>(BackendType::COUNT); ++i) {
+        BackendType type = static_cast<BackendType>(i);
+        if (name == backends::name(type)) {
+            return type;
+        }
+    }
+    return BackendType::COUNT;
+}
+
+bool backends::supported(BackendType type) {
+    switch (type) {
+    case BackendType::SCALAR:
+    case BackendType::ADAPTIVE:
+        return true;
+    case BackendType::SIMD_RAYS:
+    case BackendType::SIMD_STREAM:
+    case BackendType::TASKFLOW_SIMD:
+        //falls back to narrower packets, down to one lane
+        return true;
+    case BackendType::TASKFLOW_BATCHED:
+    case BackendType::TASKFLOW_PARALLEL_FOR:
+        //falls back to drawing without AVX2
+        return true;
+    case BackendType::SIMD_DRAWING:
+        return simd::supported(SimdIsa::AVX2);
+    case BackendType::GPU:
+#ifdef HEADLESS
+        return false;
+#else
+        return GLAD_GL_VERSION_4_3;
+#endif
+    default:
+        return false;
+    }
+}
+
+//RAYCAST_WORKERS and RAYCAST_SLICES_PER_WORKER override the taskflow
+//backends' defaults, so one machine can try other thread counts
+static TaskflowBackend* tuned(TaskflowBackend* backend) {
+
+    int workers = std::atoi(environment::variable("RAYCAST_WORKERS").c_str());
+    if (workers > 0) {
+        backend->set_workers(workers);
+    }
+    int slicesPerWorker = std::atoi(environment::variable("RAYCAST_SLICES_PER_WORKER").c_str());
+    if (slicesPerWorker > 0) {
+        backend->set_oversubscription(slicesPerWorker);
+    }
+    return backend;
+}
+
+Backend* backends::make(BackendType type, [[maybe_unused]] int width, [[maybe_unused]] int height) {
+    switch (type) {
+    case BackendType::SIMD_DRAWING:
+        return new ColumnBackend(true);
+    case BackendType::SIMD_RAYS:
+        return new SimdRaysBackend(simd::widest(), false);
+    case BackendType::SIMD_STREAM:
+        return new SimdRaysBackend(simd::widest(), true);
+    case BackendType::TASKFLOW_BATCHED:
+        return tuned(new BatchedBackend());
+    case BackendType::TASKFLOW_PARALLEL_FOR:
+        return tuned(new ParallelForBackend());
+    case BackendType::TASKFLOW_SIMD:
+        return tuned(new HybridBackend(simd::widest()));
+    case BackendType::ADAPTIVE:
+        return new AdaptiveBackend();
+#ifndef HEADLESS
+    case BackendType::GPU:
+        return new GpuBackend(width, height);
+#endif
+    default:
+        return new ColumnBackend(false);
+    }
+}
\ No newline at end of file
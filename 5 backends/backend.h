@@ -0,0 +1,49 @@
+#pragma once
+#include "config.h"
+#include "scene.h"
+#include "framebuffer.h"
+#include "frame_timer.h"
+#include "raycast.h"
+
+enum class BackendType {
+	SCALAR,
+	SIMD_DRAWING,
+	SIMD_RAYS,
+	SIMD_STREAM,
+	TASKFLOW_BATCHED,
+	TASKFLOW_PARALLEL_FOR,
+	TASKFLOW_SIMD,
+	GPU,
+	ADAPTIVE,
+	COUNT
+};
+
+/*
+	One way of turning a Scene into a frame. The Engine owns the
+	framebuffer and the presentation, backends only fill it in.
+*/
+class Backend {
+public:
+	virtual ~Backend() {}
+
+	//draw the scene into framebuffer, recording cast and draw times
+	virtual void render(Scene* scene, Framebuffer& framebuffer, FrameTimer& timings) = 0;
+
+	//backends that draw straight to the window skip the upload
+	virtual bool presents() { return false; }
+
+	//floats until told otherwise
+	virtual void set_precision(DdaPrecision precision) { this->precision = precision; }
+
+protected:
+	DdaPrecision precision = DdaPrecision::FLOAT;
+};
+
+namespace backends {
+	const char* name(BackendType type);
+	BackendType from_name(const std::string& name);
+	bool supported(BackendType type);
+	//the taskflow backends take their worker count and slices per
+	//worker from RAYCAST_WORKERS and RAYCAST_SLICES_PER_WORKER if set
+	Backend* make(BackendType type, int width, int height);
+}
\ No newline at end of file
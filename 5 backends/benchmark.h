@@ -0,0 +1,32 @@
+#pragma once
+#include "config.h"
+#include "scene.h"
+#include "frame_timer.h"
+
+struct CameraKeyframe {
+	glm::vec3 position;
+	float yaw;
+};
+
+struct CameraPath {
+	const char* name;
+	std::vector<CameraKeyframe> keyframes;
+};
+
+struct BenchmarkResult {
+	const char* backend;
+	const char* precision;
+	const char* path;
+	int width, height, frames;
+	double meanTime, medianTime, p99Time, maxTime;
+	//average of each phase, 0 if the backend doesn't have it
+	std::array<double, FrameTimer::phaseCount> phaseTimes;
+};
+
+namespace benchmark {
+	std::vector<CameraPath> camera_paths();
+	void move_camera(Scene* scene, const CameraPath& path, int frame, int frameCount);
+	BenchmarkResult summarize(const char* backend, const char* path, int width, int height, std::vector<double>& frameTimes);
+	std::vector<BenchmarkResult> run();
+	void write_json(std::ostream& out, const std::vector<BenchmarkResult>& results);
+}
\ No newline at end of file
@@ -0,0 +1,28 @@
+#include "column_backend.h"
+#include "raycast.h"
+
+ColumnBackend::ColumnBackend(bool simdDrawing) {
+    this->simdDrawing = simdDrawing;
+}
+
+void ColumnBackend::render(Scene* scene, Framebuffer& framebuffer, FrameTimer& timings) {
+
+    ColumnCaster cast_column = raycast::caster(precision);
+
+    const int width = framebuffer.width;
+    columns.resize(width);
+
+    //cast every column, then draw them all, so each phase is timed once
+    timings.begin(FramePhase::CAST);
+    for (int x = 0; x < width; ++x) {
+        columns[x] = cast_column(scene, x, width, framebuffer.height);
+    }
+    timings.end(FramePhase::CAST);
+
+    timings.begin(FramePhase::DRAW);
+    for (int x = 0; x < width; ++x) {
+        drawing::draw_column(framebuffer, x, columns[x], simdDrawing);
+    }
+    drawing::finish_columns(framebuffer);
+    timings.end(FramePhase::DRAW);
+}
\ No newline at end of file
@@ -0,0 +1,17 @@
+#pragma once
+#include "backend.h"
+
+/*
+	One scalar DDA ray per column, one column after the other. Columns
+	are filled pixel by pixel, or eight pixels at a time with SIMD drawing.
+*/
+class ColumnBackend : public Backend {
+public:
+	ColumnBackend(bool simdDrawing);
+	void render(Scene* scene, Framebuffer& framebuffer, FrameTimer& timings) override;
+
+private:
+	bool simdDrawing;
+	//the whole frame is cast before anything is drawn
+	std::vector<ColumnHit> columns;
+};
\ No newline at end of file
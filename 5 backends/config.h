@@ -0,0 +1,21 @@
+#pragma once
+#ifndef HEADLESS
+#include <glad/glad.h>
+#include <GLFW/glfw3.h>
+#endif
+#include <vector>
+#include <array>
+#include <glm/glm.hpp>
+#include <glm/gtc/matrix_transform.hpp>
+#include <glm/gtc/type_ptr.hpp>
+#include <glm/gtx/euler_angles.hpp>
+#include <cstdlib>
+#include <cstdint>
+#include <algorithm>
+#include <chrono>
+#include <atomic>
+#include <string>
+#include <sstream>
+#include <fstream>
+#include <iostream>
+#include <immintrin.h>
\ No newline at end of file
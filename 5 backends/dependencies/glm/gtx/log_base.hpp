@@ -0,0 +1,48 @@
+/// @ref gtx_log_base
+/// @file glm/gtx/log_base.hpp
+///
+/// @see core (dependence)
+///
+/// @defgroup gtx_log_base GLM_GTX_log_base
+/// @ingroup gtx
+///
+/// Include <glm/gtx/log_base.hpp> to use the features of this extension.
+///
+/// Logarithm for any base. base can be a vector or a scalar.
+
+#pragma once
+
+// Dependency:
+#include "../glm.hpp"
+
+#if GLM_MESSAGES == GLM_ENABLE && !defined(GLM_EXT_INCLUDED)
+#	ifndef GLM_ENABLE_EXPERIMENTAL
+#		pragma message("GLM: GLM_GTX_log_base is an experimental extension and may change in the future. Use #define GLM_ENABLE_EXPERIMENTAL before including it, if you really want to use it.")
+#	else
+#		pragma message("GLM: GLM_GTX_log_base extension included")
+#	endif
+#endif
+
+namespace glm
+{
+	/// @addtogroup gtx_log_base
+	/// @{
+
+	/// Logarithm for any base.
+	/// From GLM_GTX_log_base.
+	template<typename genType>
+	GLM_FUNC_DECL genType log(
+		genType const& x,
+		genType const& base);
+
+	/// Logarithm for any base.
+	/// From GLM_GTX_log_base.
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_DECL vec<L, T, Q> sign(
+		vec<L, T, Q> const& x,
+		vec<L, T, Q> const& base);
+
+	/// @}
+}//namespace glm
+
+#include "log_base.inl"
@@ -0,0 +1,324 @@
+#include "engine.h"
+#include "raycast.h"
+
+Engine::Engine(int width, int height, BackendType backendType, uint32_t* target) {
+
+#ifndef HEADLESS
+    shader = util::load_shader("shaders/vertex.txt", "shaders/fragment.txt");
+    spanShader = util::load_shader("shaders/raycast_vertex.txt", "shaders/span_geometry.txt", "shaders/raycast_fragment.txt");
+    glProgramUniform1i(spanShader, glGetUniformLocation(spanShader, "screenWidth"), width);
+    glProgramUniform1i(spanShader, glGetUniformLocation(spanShader, "screenHeight"), height);
+    glUseProgram(shader);
+
+    glClearColor(0.0f, 0.0f, 0.0f, 1.0f);
+#endif
+
+    this->width = width;
+    this->height = height;
+    framebuffer.width = width;
+    framebuffer.height = height;
+    framebuffer.pixels = target;
+    framebuffer.stride = height;
+    callerTarget = target != nullptr;
+#ifndef HEADLESS
+    screenMesh = new QuadModel;
+    create_palette();
+#endif
+
+    create_color_buffer(width, height);
+
+    backend = nullptr;
+    set_backend(backendType);
+
+}
+
+Engine::~Engine() {
+    delete backend;
+    destroy_color_buffer();
+#ifndef HEADLESS
+    delete screenMesh;
+    glDeleteTextures(1, &paletteTexture);
+    glDeleteProgram(spanShader);
+    glDeleteProgram(shader);
+#endif
+}
+
+void Engine::create_color_buffer(int width, int height) {
+
+#ifndef HEADLESS
+    //sized once, pixels are stored column by column so the texture is
+    //height x width. Indices can't be filtered, the shader fetches them.
+    //Spans go straight to the window, with no texture between.
+    bool indexed = format == FrameFormat::INDEXED;
+    if (format != FrameFormat::SPANS) {
+        glCreateTextures(GL_TEXTURE_2D, 1, &colorBuffer);
+        glTextureParameteri(colorBuffer, GL_TEXTURE_WRAP_S, GL_REPEAT);
+        glTextureParameteri(colorBuffer, GL_TEXTURE_WRAP_T, GL_REPEAT);
+        glTextureParameteri(colorBuffer, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+        glTextureParameteri(colorBuffer, GL_TEXTURE_MAG_FILTER, indexed ? GL_NEAREST : GL_LINEAR);
+        glTextureStorage2D(colorBuffer, 1, indexed ? GL_R8UI : GL_RGBA8, height, width);
+        glBindTextureUnit(indexed ? 1 : 0, colorBuffer);
+    }
+    glProgramUniform1i(shader, glGetUniformLocation(shader, "indexed"), indexed);
+
+    if (!callerTarget) {
+        create_upload_ring();
+        return;
+    }
+#endif
+
+    //only back the framebuffer ourselves if the caller didn't
+    if (!callerTarget) {
+        colorBufferMemory.allocate(framebuffer, width, height, format);
+    }
+
+}
+
+void Engine::destroy_color_buffer() {
+
+#ifndef HEADLESS
+    if (uploadBuffer) {
+        for (GLsync& fence : uploadFences) {
+            glDeleteSync(fence);
+            fence = nullptr;
+        }
+        glUnmapNamedBuffer(uploadBuffer);
+        glDeleteBuffers(1, &uploadBuffer);
+        uploadBuffer = 0;
+        uploadMemory = nullptr;
+    }
+    glDeleteTextures(1, &colorBuffer);
+    colorBuffer = 0;
+#endif
+    colorBufferMemory.release();
+}
+
+FrameFormat Engine::set_format(FrameFormat format) {
+
+    if (callerTarget || format == this->format) {
+        return this->format;
+    }
+
+    //everything holding pixels changes shape, so start them over
+    destroy_color_buffer();
+    this->format = format;
+    framebuffer.pixels = nullptr;
+    framebuffer.indices = nullptr;
+    framebuffer.spans = nullptr;
+    framebuffer.streamStores = false;
+    create_color_buffer(width, height);
+
+    timings.reset();
+    return format;
+}
+
+#ifndef HEADLESS
+void Engine::create_palette() {
+
+    uint32_t entries[raycast::paletteSize];
+    raycast::build_palette(entries);
+    glCreateTextures(GL_TEXTURE_2D, 1, &paletteTexture);
+    glTextureParameteri(paletteTexture, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+    glTextureParameteri(paletteTexture, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+    glTextureStorage2D(paletteTexture, 1, GL_RGBA8, raycast::paletteSize, 1);
+    glTextureSubImage2D(paletteTexture, 0, 0, 0, raycast::paletteSize, 1, GL_RGBA, GL_UNSIGNED_BYTE, entries);
+    glBindTextureUnit(2, paletteTexture);
+}
+
+void Engine::create_upload_ring() {
+
+    //Coherent, so what the backends write needs no flushing before the
+    //copy. Columns are padded as in FramebufferMemory, so slots are
+    //whole cache lines too. The span shader reads span lists from
+    //their slot, which has to start where storage buffers may.
+    if (format == FrameFormat::SPANS) {
+        GLint alignment = 1;
+        glGetIntegerv(GL_SHADER_STORAGE_BUFFER_OFFSET_ALIGNMENT, &alignment);
+        alignment = std::max(alignment, FramebufferMemory::lineBytes);
+        framebuffer.stride = 0;
+        uploadSlotBytes = (width * sizeof(ColumnSpan) + alignment - 1) / alignment * alignment;
+    }
+    else {
+        int pixelBytes = FramebufferMemory::pixel_bytes(format);
+        framebuffer.stride = FramebufferMemory::column_stride(height, pixelBytes);
+        uploadSlotBytes = static_cast<size_t>(framebuffer.stride) * width * pixelBytes;
+    }
+    GLsizeiptr slotBytes = static_cast<GLsizeiptr>(uploadSlotBytes);
+    GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+    glCreateBuffers(1, &uploadBuffer);
+    glNamedBufferStorage(uploadBuffer, slotBytes * uploadSlots, nullptr, flags);
+    uploadMemory = static_cast<char*>(glMapNamedBufferRange(uploadBuffer, 0, slotBytes * uploadSlots, flags));
+
+    //only the GPU reads the slots, so there's no use caching them
+    uploadSlot = 0;
+    point_at_upload_slot();
+    framebuffer.streamStores = true;
+}
+
+void Engine::acquire_upload_slot() {
+
+    uploadSlot = (uploadSlot + 1) % uploadSlots;
+    GLsync& fence = uploadFences[uploadSlot];
+    if (fence) {
+        //wait for the copy out of this slot, flushing the first time so
+        //it is sure to get there
+        GLbitfield waitFlags = GL_SYNC_FLUSH_COMMANDS_BIT;
+        while (glClientWaitSync(fence, waitFlags, 1000000) == GL_TIMEOUT_EXPIRED) {
+            waitFlags = 0;
+        }
+        glDeleteSync(fence);
+        fence = nullptr;
+    }
+
+    point_at_upload_slot();
+}
+
+void Engine::point_at_upload_slot() {
+
+    char* slot = uploadMemory + uploadSlotBytes * uploadSlot;
+    switch (format) {
+    case FrameFormat::INDEXED:
+        framebuffer.indices = reinterpret_cast<uint8_t*>(slot);
+        break;
+    case FrameFormat::SPANS:
+        framebuffer.spans = reinterpret_cast<ColumnSpan*>(slot);
+        break;
+    default:
+        framebuffer.pixels = reinterpret_cast<uint32_t*>(slot);
+    }
+}
+#endif
+
+BackendType Engine::set_backend(BackendType backendType) {
+
+    if (!backends::supported(backendType)) {
+        backendType = BackendType::SCALAR;
+    }
+
+    delete backend;
+    backend = backends::make(backendType, width, height);
+    backend->set_precision(precision);
+    this->backendType = backendType;
+
+    //old samples belong to the previous backend
+    timings.reset();
+    return backendType;
+}
+
+BackendType Engine::pick_fastest_backend(Scene* scene, int trialFrames) {
+
+    BackendType fastest = BackendType::SCALAR;
+    double fastestTime = 1e30;
+
+    for (int i = 0; i < static_cast<int>(BackendType::COUNT); ++i) {
+
+        BackendType candidate = static_cast<BackendType>(i);
+        if (!backends::supported(candidate)) {
+            continue;
+        }
+        set_backend(candidate);
+
+        //the first frame pays for any setup, so leave it out
+        render(scene);
+        auto start = FrameTimer::now();
+        for (int frame = 0; frame < trialFrames; ++frame) {
+            render(scene);
+        }
+#ifndef HEADLESS
+        glFinish();
+#endif
+        double trialTime = FrameTimer::milliseconds(start, FrameTimer::now());
+
+        if (trialTime < fastestTime) {
+            fastestTime = trialTime;
+            fastest = candidate;
+        }
+    }
+
+    return set_backend(fastest);
+}
+
+void Engine::set_precision(DdaPrecision precision) {
+
+    this->precision = precision;
+    backend->set_precision(precision);
+    timings.reset();
+}
+
+void Engine::render(Scene* scene) {
+
+#ifndef HEADLESS
+    if (uploadBuffer && !backend->presents()) {
+        acquire_upload_slot();
+    }
+#endif
+
+    backend->render(scene, framebuffer, timings);
+
+#ifndef HEADLESS
+    if (!backend->presents()) {
+        draw_screen();
+    }
+#endif
+}
+
+#ifndef HEADLESS
+void Engine::draw_screen() {
+
+    if (format == FrameFormat::SPANS) {
+        draw_spans();
+        return;
+    }
+    bool indexed = format == FrameFormat::INDEXED;
+
+    glUseProgram(shader);
+
+    glBindTextureUnit(indexed ? 1 : 0, colorBuffer);
+
+    //from the slot just drawn, the copy runs on while the next frame is
+    //drawn into another
+    timings.begin(FramePhase::UPLOAD);
+    GLenum format = indexed ? GL_RED_INTEGER : GL_RGBA;
+    const char* frame = indexed ? reinterpret_cast<const char*>(framebuffer.indices)
+        : reinterpret_cast<const char*>(framebuffer.pixels);
+    glPixelStorei(GL_UNPACK_ROW_LENGTH, framebuffer.stride);
+    //columns of indices needn't be a multiple of four bytes apart
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+    if (uploadBuffer) {
+        glBindBuffer(GL_PIXEL_UNPACK_BUFFER, uploadBuffer);
+        const void* offset = reinterpret_cast<const void*>(frame - uploadMemory);
+        glTextureSubImage2D(colorBuffer, 0, 0, 0, height, width, format, GL_UNSIGNED_BYTE, offset);
+        glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+        uploadFences[uploadSlot] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    }
+    else {
+        glTextureSubImage2D(colorBuffer, 0, 0, 0, height, width, format, GL_UNSIGNED_BYTE, frame);
+    }
+    glPixelStorei(GL_UNPACK_ROW_LENGTH, 0);
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+    timings.end(FramePhase::UPLOAD);
+
+    timings.begin(FramePhase::PRESENT);
+    glBindVertexArray(screenMesh->VAO);
+    glDrawArrays(GL_TRIANGLES, 0, 6);
+    glFlush();
+    timings.end(FramePhase::PRESENT);
+
+}
+
+void Engine::draw_spans() {
+
+    //nothing to upload, the shader reads the slot just drawn where it
+    //is and fills every column in as a line
+    timings.begin(FramePhase::PRESENT);
+    glUseProgram(spanShader);
+    glBindBufferRange(GL_SHADER_STORAGE_BUFFER, 4, uploadBuffer,
+        static_cast<GLintptr>(uploadSlotBytes * uploadSlot), static_cast<GLsizeiptr>(width * sizeof(ColumnSpan)));
+    glClear(GL_COLOR_BUFFER_BIT);
+    glBindVertexArray(screenMesh->VAO);
+    glDrawArraysInstanced(GL_POINTS, 0, 1, width);
+    uploadFences[uploadSlot] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    glFlush();
+    timings.end(FramePhase::PRESENT);
+}
+#endif
\ No newline at end of file
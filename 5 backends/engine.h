@@ -0,0 +1,97 @@
+#pragma once
+#include "config.h"
+#include "scene.h"
+#include "frame_timer.h"
+#include "framebuffer.h"
+#include "backend.h"
+#ifndef HEADLESS
+#include "shader.h"
+#include "quad_model.h"
+#endif
+
+/*
+	Owns the framebuffer and the window presentation, and hands the
+	actual rendering to whichever backend is selected. Backends can be
+	swapped between frames.
+
+	With a window, the framebuffer backends draw into is a slot in a
+	ring of persistently mapped pixel buffers. Presenting a frame starts
+	the copy from its slot into the screen texture, which has immutable
+	storage, and fences it; the next frame is drawn into the next slot
+	while that copy is still running, and only waits on a slot's fence
+	once the ring comes back round to it. Without a window, or with a
+	caller-owned target, frames are drawn into ordinary memory.
+
+	Indexed, the framebuffer, ring and screen texture all hold a byte a
+	pixel and the shader resolves them through the palette texture, so
+	drawing writes and the upload copies a quarter as much. Fog comes in
+	raycast::fogLevels steps then, and the screen is never filtered.
+
+	As span lists, each slot holds one ColumnSpan per column and nothing is
+	uploaded: the span shader reads the slot and draws every column as a
+	line, as GpuBackend draws its casts. Without a window the spans are
+	left for the caller, drawing::fill_spans turns them into pixels.
+*/
+class Engine {
+public:
+	//target: optional caller-owned buffer of width * height pixels,
+	//stored column by column with no padding. Defaults to
+	//colorBufferMemory, or the upload ring with a window.
+	Engine(int width, int height, BackendType backendType, uint32_t* target = nullptr);
+	~Engine();
+
+	//returns the backend actually in use, scalar if the requested one
+	//isn't supported on this machine
+	BackendType set_backend(BackendType backendType);
+	//renders a few frames with every supported backend and keeps the fastest
+	BackendType pick_fastest_backend(Scene* scene, int trialFrames);
+	//every backend from now on casts with this precision
+	void set_precision(DdaPrecision precision);
+	//returns the format frames now come in, always RGBA with a
+	//caller-owned target
+	FrameFormat set_format(FrameFormat format);
+
+	void render(Scene* scene);
+	void create_color_buffer(int width, int height);
+	void destroy_color_buffer();
+#ifndef HEADLESS
+	void create_palette();
+	void draw_spans();
+	void draw_screen();
+	void create_upload_ring();
+	//point the framebuffer at the next free slot in the ring
+	void acquire_upload_slot();
+	void point_at_upload_slot();
+#endif
+
+	unsigned int width, height;
+	FramebufferMemory colorBufferMemory;
+	Framebuffer framebuffer;
+	//the framebuffer belongs to the caller
+	bool callerTarget;
+	FrameFormat format = FrameFormat::RGBA;
+#ifndef HEADLESS
+	unsigned int shader, spanShader;
+	//0 for span lists
+	unsigned int colorBuffer = 0;
+	//raycast::palette, one texel an entry
+	unsigned int paletteTexture;
+	QuadModel* screenMesh;
+
+	//frames in flight between drawing and the screen texture
+	static const int uploadSlots = 3;
+	//one buffer holding every slot, mapped for as long as it lives, or
+	//0 when the framebuffer belongs to the caller
+	unsigned int uploadBuffer = 0;
+	char* uploadMemory = nullptr;
+	size_t uploadSlotBytes = 0;
+	GLsync uploadFences[uploadSlots] = {};
+	int uploadSlot = 0;
+#endif
+
+	BackendType backendType;
+	Backend* backend;
+	DdaPrecision precision = DdaPrecision::FLOAT;
+
+	FrameTimer timings;
+};
\ No newline at end of file
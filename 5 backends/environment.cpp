@@ -0,0 +1,18 @@
+#include "environment.h"
+
+std::string environment::variable(const char* name) {
+#ifdef _MSC_VER
+    //getenv is deprecated there, and SDL checks make that an error
+    char* value = nullptr;
+    size_t length = 0;
+    std::string result;
+    if (_dupenv_s(&value, &length, name) == 0 && value) {
+        result = value;
+        free(value);
+    }
+    return result;
+#else
+    const char* value = std::getenv(name);
+    return value ? value : "";
+#endif
+}
\ No newline at end of file
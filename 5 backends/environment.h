@@ -0,0 +1,8 @@
+#pragma once
+#include "config.h"
+
+//settings read from the environment, like RAYCAST_SIMD and RAYCAST_WORKERS
+namespace environment {
+	//empty when it isn't set
+	std::string variable(const char* name);
+}
\ No newline at end of file
@@ -0,0 +1,107 @@
+#include "frame_timer.h"
+
+FrameTimer::FrameTimer() {
+	reset();
+}
+
+std::chrono::high_resolution_clock::time_point FrameTimer::now() {
+	return std::chrono::high_resolution_clock::now();
+}
+
+double FrameTimer::milliseconds(std::chrono::high_resolution_clock::time_point from,
+	std::chrono::high_resolution_clock::time_point to) {
+	return std::chrono::duration<double, std::milli>(to - from).count();
+}
+
+void FrameTimer::begin(FramePhase phase) {
+	started[static_cast<int>(phase)] = now();
+}
+
+void FrameTimer::end(FramePhase phase) {
+	record(phase, milliseconds(started[static_cast<int>(phase)], now()));
+}
+
+void FrameTimer::record(FramePhase phase, double milliseconds) {
+	int i = static_cast<int>(phase);
+	history[i][head[i]] = static_cast<float>(milliseconds);
+	head[i] = (head[i] + 1) % sampleCount;
+	count[i] = std::min(count[i] + 1, sampleCount);
+}
+
+void FrameTimer::reset() {
+	head.fill(0);
+	count.fill(0);
+}
+
+int FrameTimer::samples(FramePhase phase) {
+	return count[static_cast<int>(phase)];
+}
+
+double FrameTimer::latest(FramePhase phase) {
+	int i = static_cast<int>(phase);
+	if (count[i] == 0) {
+		return 0.0;
+	}
+	return history[i][(head[i] + sampleCount - 1) % sampleCount];
+}
+
+double FrameTimer::average(FramePhase phase) {
+	int i = static_cast<int>(phase);
+	if (count[i] == 0) {
+		return 0.0;
+	}
+	double total = 0.0;
+	for (int sample = 0; sample < count[i]; ++sample) {
+		total += history[i][sample];
+	}
+	return total / count[i];
+}
+
+double FrameTimer::worst(FramePhase phase) {
+	int i = static_cast<int>(phase);
+	float slowest = 0.0f;
+	for (int sample = 0; sample < count[i]; ++sample) {
+		slowest = std::max(slowest, history[i][sample]);
+	}
+	return slowest;
+}
+
+const char* FrameTimer::name(FramePhase phase) {
+	switch (phase) {
+	case FramePhase::INPUT:
+		return "input";
+	case FramePhase::UPDATE:
+		return "update";
+	case FramePhase::RENDER:
+		return "render";
+	case FramePhase::CLEAR:
+		return "clear";
+	case FramePhase::CAST:
+		return "cast";
+	case FramePhase::DRAW:
+		return "draw";
+	case FramePhase::UPLOAD:
+		return "upload";
+	case FramePhase::PRESENT:
+		return "present";
+	default:
+		return "unknown";
+	}
+}
+
+std::string FrameTimer::summary() {
+
+	//average ms of every phase that has been recorded
+	std::stringstream text;
+	text.precision(2);
+	text << std::fixed;
+	for (int i = 0; i < phaseCount; ++i) {
+		FramePhase phase = static_cast<FramePhase>(i);
+		if (count[i] == 0) {
+			continue;
+		}
+		text << name(phase) << ' ' << average(phase) << ' ';
+	}
+	text << "ms";
+	return text.str();
+}
\ No newline at end of file
@@ -0,0 +1,220 @@
+#include "framebuffer.h"
+#include "raycast.h"
+#include <cstring>
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <sys/mman.h>
+#endif
+
+void drawing::fill_column(Framebuffer& framebuffer, int x, int y1, int y2, uint32_t color, uint32_t background) {
+
+    uint32_t* column = framebuffer.pixels + framebuffer.stride * x;
+    const int height = framebuffer.height;
+    int spanStart = std::max(0, std::min(y1, height));
+    int spanEnd = std::max(spanStart, std::min(y2 + 1, height));
+
+    for (int y = 0; y < spanStart; ++y) {
+        column[y] = background;
+    }
+    for (int y = spanStart; y < spanEnd; ++y) {
+        column[y] = color;
+    }
+    for (int y = spanEnd; y < height; ++y) {
+        column[y] = background;
+    }
+}
+
+SIMD_TARGET("avx2") void drawing::fill_column_avx2(Framebuffer& framebuffer, int x, int y1, int y2, uint32_t color, uint32_t background) {
+
+    uint32_t* column = framebuffer.pixels + framebuffer.stride * x;
+    const int height = framebuffer.height;
+
+    //single pixels up to the first aligned block
+    int y = 0;
+    while (y < height && (reinterpret_cast<uintptr_t>(column + y) & 31)) {
+        column[y] = y >= y1 && y <= y2 ? color : background;
+        ++y;
+    }
+
+    //Then eight at a time, each block picking its pixels from either
+    //color, so one store covers any edge of the span inside it
+    const __m256i colorSIMD = _mm256_set1_epi32(color);
+    const __m256i backgroundSIMD = _mm256_set1_epi32(background);
+    const __m256i first = _mm256_set1_epi32(y1);
+    const __m256i last = _mm256_set1_epi32(y2);
+    const __m256i eight = _mm256_set1_epi32(8);
+    __m256i rows = _mm256_add_epi32(_mm256_set1_epi32(y), _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7));
+    for (; y + 8 <= height; y += 8) {
+        __m256i outside = _mm256_or_si256(_mm256_cmpgt_epi32(first, rows), _mm256_cmpgt_epi32(rows, last));
+        __m256i block = _mm256_blendv_epi8(colorSIMD, backgroundSIMD, outside);
+        if (framebuffer.streamStores) {
+            _mm256_stream_si256(reinterpret_cast<__m256i*>(column + y), block);
+        }
+        else {
+            _mm256_store_si256(reinterpret_cast<__m256i*>(column + y), block);
+        }
+        rows = _mm256_add_epi32(rows, eight);
+    }
+
+    //and whatever is left
+    for (; y < height; ++y) {
+        column[y] = y >= y1 && y <= y2 ? color : background;
+    }
+}
+
+void drawing::fill_column_indexed(Framebuffer& framebuffer, int x, int y1, int y2, uint8_t index, uint8_t background) {
+
+    uint8_t* column = framebuffer.indices + framebuffer.stride * x;
+    const int height = framebuffer.height;
+    int spanStart = std::max(0, std::min(y1, height));
+    int spanEnd = std::max(spanStart, std::min(y2 + 1, height));
+
+    std::memset(column, background, spanStart);
+    std::memset(column + spanStart, index, spanEnd - spanStart);
+    std::memset(column + spanEnd, background, height - spanEnd);
+}
+
+void drawing::record_span(Framebuffer& framebuffer, int x, int y1, int y2, uint32_t color) {
+
+    //only what's on screen, so it fits
+    const int height = framebuffer.height;
+    ColumnSpan& span = framebuffer.spans[x];
+    span.start = static_cast<int16_t>(std::max(0, std::min(y1, height)));
+    span.end = static_cast<int16_t>(std::max(span.start - 1, std::min(y2, height - 1)));
+    span.color = color;
+}
+
+void drawing::draw_column(Framebuffer& framebuffer, int x, const ColumnHit& column, bool avx2) {
+
+    //the whole column, the stripe and the background around it
+    if (framebuffer.spans) {
+        drawing::record_span(framebuffer, x, column.drawStart, column.drawEnd, column.color);
+    }
+    else if (framebuffer.indices) {
+        drawing::fill_column_indexed(framebuffer, x, column.drawStart, column.drawEnd, column.paletteIndex, 0);
+    }
+    else if (avx2) {
+        drawing::fill_column_avx2(framebuffer, x, column.drawStart, column.drawEnd, column.color, 0);
+    }
+    else {
+        drawing::fill_column(framebuffer, x, column.drawStart, column.drawEnd, column.color, 0);
+    }
+}
+
+void drawing::fill_spans(Framebuffer& framebuffer, const ColumnSpan* spans, uint32_t background) {
+
+    static const bool avx2 = simd::supported(SimdIsa::AVX2);
+    for (int x = 0; x < static_cast<int>(framebuffer.width); ++x) {
+        const ColumnSpan& span = spans[x];
+        if (avx2) {
+            fill_column_avx2(framebuffer, x, span.start, span.end, span.color, background);
+        }
+        else {
+            fill_column(framebuffer, x, span.start, span.end, span.color, background);
+        }
+    }
+    finish_columns(framebuffer);
+}
+
+const char* drawing::format_name(FrameFormat format) {
+    switch (format) {
+    case FrameFormat::INDEXED:
+        return "indexed";
+    case FrameFormat::SPANS:
+        return "spans";
+    default:
+        return "rgba";
+    }
+}
+
+void drawing::finish_columns(Framebuffer& framebuffer) {
+    if (framebuffer.streamStores) {
+        _mm_sfence();
+    }
+}
+
+void drawing::pset(Framebuffer& framebuffer, int x, int y, glm::vec3 color) {
+    uint8_t r = std::max(0, std::min(255, (int)(255 * color.x)));
+    uint8_t g = std::max(0, std::min(255, (int)(255 * color.y)));
+    uint8_t b = std::max(0, std::min(255, (int)(255 * color.z)));
+    framebuffer.pixels[y + framebuffer.stride * x] = (r << 24) + (g << 8) + (b << 16);
+}
+
+FramebufferMemory::~FramebufferMemory() {
+    release();
+}
+
+int FramebufferMemory::pixel_bytes(FrameFormat format) {
+    switch (format) {
+    case FrameFormat::INDEXED:
+        return sizeof(uint8_t);
+    case FrameFormat::SPANS:
+        return sizeof(ColumnSpan);
+    default:
+        return sizeof(uint32_t);
+    }
+}
+
+void FramebufferMemory::allocate(Framebuffer& framebuffer, int width, int height, FrameFormat format) {
+
+    release();
+    framebuffer.width = width;
+    framebuffer.height = height;
+    if (format == FrameFormat::SPANS) {
+        framebuffer.stride = 0;
+        bytes = static_cast<size_t>(width) * sizeof(ColumnSpan);
+    }
+    else {
+        int pixelBytes = pixel_bytes(format);
+        framebuffer.stride = column_stride(height, pixelBytes);
+        bytes = static_cast<size_t>(framebuffer.stride) * width * pixelBytes;
+    }
+
+    //huge pages when the frame fills one, page aligned otherwise
+    size_t hugeBytes = (bytes + hugePageBytes - 1) & ~(hugePageBytes - 1);
+#ifdef _WIN32
+    size_t largePage = GetLargePageMinimum();
+    if (largePage && bytes >= largePage) {
+        hugeBytes = (bytes + largePage - 1) & ~(largePage - 1);
+        memory = VirtualAlloc(nullptr, hugeBytes, MEM_RESERVE | MEM_COMMIT | MEM_LARGE_PAGES, PAGE_READWRITE);
+    }
+    hugePages = memory != nullptr;
+    if (hugePages) {
+        bytes = hugeBytes;
+    }
+    else {
+        memory = VirtualAlloc(nullptr, bytes, MEM_RESERVE | MEM_COMMIT, PAGE_READWRITE);
+    }
+#else
+    if (bytes >= hugePageBytes) {
+        bytes = hugeBytes;
+        memory = std::aligned_alloc(hugePageBytes, bytes);
+        hugePages = memory && madvise(memory, bytes, MADV_HUGEPAGE) == 0;
+    }
+    if (!memory) {
+        bytes = (bytes + pageBytes - 1) & ~(pageBytes - 1);
+        memory = std::aligned_alloc(pageBytes, bytes);
+    }
+#endif
+    framebuffer.pixels = format == FrameFormat::RGBA ? static_cast<uint32_t*>(memory) : nullptr;
+    framebuffer.indices = format == FrameFormat::INDEXED ? static_cast<uint8_t*>(memory) : nullptr;
+    framebuffer.spans = format == FrameFormat::SPANS ? static_cast<ColumnSpan*>(memory) : nullptr;
+}
+
+void FramebufferMemory::release() {
+
+    if (!memory) {
+        return;
+    }
+#ifdef _WIN32
+    VirtualFree(memory, 0, MEM_RELEASE);
+#else
+    std::free(memory);
+#endif
+    memory = nullptr;
+    bytes = 0;
+    hugePages = false;
+}
\ No newline at end of file
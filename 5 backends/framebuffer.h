@@ -0,0 +1,116 @@
+#pragma once
+#include "config.h"
+#include "simd.h"
+
+struct ColumnHit;
+
+//how a Framebuffer holds its frame
+enum class FrameFormat {
+	//a color a pixel
+	RGBA,
+	//a byte a pixel, naming a raycast::palette entry
+	INDEXED,
+	//one ColumnSpan per column, rasterized later
+	SPANS
+};
+
+//A column as a span list has it: color from start to end, background
+//above and below. Sky is an empty span.
+struct ColumnSpan {
+	int16_t start, end;
+	uint32_t color;
+};
+
+/*
+	A view of the pixels a backend draws into. Pixels are stored column
+	by column, so pixel (x, y) lives at y + stride * x, and the engine
+	uploads them as a height x width texture.
+
+	Backends draw every column whole, background and wall span together,
+	so nothing needs clearing first and every pixel is written once.
+
+	An indexed framebuffer has indices instead of pixels: a byte a pixel,
+	naming a raycast::palette entry, laid out the same way. The shader
+	looks the colors up.
+
+	A span list has neither, only spans, one a column. The frame is then
+	a few bytes a column, and whoever ends up showing it fills the
+	pixels in: the engine's span shader, drawing::fill_spans, or
+	anything the spans can be sent to.
+*/
+struct Framebuffer {
+	unsigned int width, height;
+	uint32_t* pixels;
+	//pixels from the start of one column to the next, at least height
+	unsigned int stride;
+	//set instead of pixels on an indexed framebuffer
+	uint8_t* indices = nullptr;
+	//set instead of pixels on a span list
+	ColumnSpan* spans = nullptr;
+	//Nothing reads the pixels back until the frame is done, so they can
+	//bypass the cache with non-temporal stores
+	bool streamStores = false;
+};
+
+/*
+	Pixels a Framebuffer can own, laid out so threads drawing different
+	columns never write to the same cache line: every column starts on a
+	line of its own and the stride is padded to whole lines. Buffers of
+	a huge page or more ask the system for huge pages, so the whole frame
+	needs a handful of TLB entries, and quietly make do with ordinary
+	pages when there are none to be had.
+*/
+class FramebufferMemory {
+public:
+	FramebufferMemory() {}
+	FramebufferMemory(const FramebufferMemory&) = delete;
+	FramebufferMemory& operator=(const FramebufferMemory&) = delete;
+	~FramebufferMemory();
+
+	//room for width columns of height pixels in format, set up in
+	//framebuffer
+	void allocate(Framebuffer& framebuffer, int width, int height, FrameFormat format = FrameFormat::RGBA);
+	void release();
+
+	//bytes a pixel takes, or a column for SPANS
+	static int pixel_bytes(FrameFormat format);
+
+	//a column stride for height pixels, padded to whole cache lines
+	static unsigned int column_stride(int height, int pixelBytes = sizeof(uint32_t)) {
+		int perLine = lineBytes / pixelBytes;
+		return (height + perLine - 1) / perLine * perLine;
+	}
+
+	static const int lineBytes = 64;
+	static const int linePixels = lineBytes / sizeof(uint32_t);
+	static const size_t hugePageBytes = 2 << 20;
+	static const size_t pageBytes = 4096;
+
+	//whether huge pages were had
+	bool hugePages = false;
+
+private:
+	void* memory = nullptr;
+	size_t bytes = 0;
+};
+
+namespace drawing {
+	//column x: color from y1 to y2, background above and below
+	void fill_column(Framebuffer& framebuffer, int x, int y1, int y2, uint32_t color, uint32_t background);
+	//the avx2 version is only safe once simd::supported(SimdIsa::AVX2)
+	void fill_column_avx2(Framebuffer& framebuffer, int x, int y1, int y2, uint32_t color, uint32_t background);
+	//the same on an indexed framebuffer
+	void fill_column_indexed(Framebuffer& framebuffer, int x, int y1, int y2, uint8_t index, uint8_t background);
+	//and on a span list
+	void record_span(Framebuffer& framebuffer, int x, int y1, int y2, uint32_t color);
+	//column x in whatever format the framebuffer holds, the hit over a
+	//black background; avx2 as for fill_column_avx2
+	void draw_column(Framebuffer& framebuffer, int x, const ColumnHit& column, bool avx2);
+	//every column of an RGBA framebuffer from a span list as wide
+	void fill_spans(Framebuffer& framebuffer, const ColumnSpan* spans, uint32_t background);
+	const char* format_name(FrameFormat format);
+	//call once a thread has filled its columns, so that any non-temporal
+	//stores land before the frame is handed on
+	void finish_columns(Framebuffer& framebuffer);
+	void pset(Framebuffer& framebuffer, int x, int y, glm::vec3 color);
+}
\ No newline at end of file
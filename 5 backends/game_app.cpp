@@ -0,0 +1,233 @@
+#include "game_app.h"
+
+GameApp::GameApp(int width, int height, const std::string& backendName) {
+	this->width = width;
+	this->height = height;
+
+	lastTime = glfwGetTime();
+	numFrames = 0;
+	frameTime = 16.0f;
+
+	window = makeWindow();
+	glfwSetInputMode(window, GLFW_CURSOR, GLFW_CURSOR_HIDDEN);
+
+	scene = new Scene();
+	if (backendName == "auto") {
+		renderer = new Engine(width, height, BackendType::SCALAR);
+		requestedBackend = renderer->pick_fastest_backend(scene, 60);
+	}
+	else {
+		requestedBackend = backends::from_name(backendName);
+		renderer = new Engine(width, height, requestedBackend);
+	}
+
+	mainLoop();
+}
+
+GLFWwindow* GameApp::makeWindow() {
+	glfwInit();
+
+	glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 4);
+	glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 5);
+	glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
+	glfwWindowHint(GLFW_DOUBLEBUFFER, GLFW_FALSE);
+
+	GLFWwindow* window = glfwCreateWindow(width, height, "This is working I hope", NULL, NULL);
+
+	glfwMakeContextCurrent(window);
+
+	gladLoadGLLoader((GLADloadproc)glfwGetProcAddress);
+
+	glViewport(0, 0, width, height);
+
+	return window;
+}
+
+returnCode GameApp::processInput() {
+
+	int wasdState{ 0 };
+	float walk_direction{ scene->player->eulers.z };
+	bool walking{ false };
+
+	if (glfwGetKey(window, GLFW_KEY_W) == GLFW_PRESS) {
+		wasdState += 1;
+	}
+
+	if (glfwGetKey(window, GLFW_KEY_A) == GLFW_PRESS) {
+		wasdState += 2;
+	}
+
+	if (glfwGetKey(window, GLFW_KEY_S) == GLFW_PRESS) {
+		wasdState += 4;
+	}
+
+	if (glfwGetKey(window, GLFW_KEY_D) == GLFW_PRESS) {
+		wasdState += 8;
+	}
+
+	switch (wasdState) {
+	case 1:
+	case 11:
+		//forwards
+		walking = true;
+		break;
+	case 3:
+		//left-forwards
+		walking = true;
+		walk_direction += 45;
+		break;
+	case 2:
+	case 7:
+		//left
+		walking = true;
+		walk_direction += 90;
+		break;
+	case 6:
+		//left-backwards
+		walking = true;
+		walk_direction += 135;
+		break;
+	case 4:
+	case 14:
+		//backwards
+		walking = true;
+		walk_direction += 180;
+		break;
+	case 12:
+		//right-backwards
+		walking = true;
+		walk_direction += 225;
+		break;
+	case 8:
+	case 13:
+		//right
+		walking = true;
+		walk_direction += 270;
+		break;
+	case 9:
+		//right-forwards
+		walking = true;
+		walk_direction += 315;
+	}
+
+	if (walking) {
+		scene->movePlayer(
+			0.1f * frameTime / 16.0f * glm::vec3{
+				glm::cos(glm::radians(walk_direction)),
+				glm::sin(glm::radians(walk_direction)),
+				0.0f
+			}
+		);
+	}
+
+	double mouse_x, mouse_y;
+	glfwGetCursorPos(window, &mouse_x, &mouse_y);
+	glfwSetCursorPos(window, static_cast<double>(width / 2), static_cast<double>(height / 2));
+
+	float delta_x{ static_cast<float>(mouse_x - static_cast<double>(width / 2)) };
+
+	scene->spinPlayer(
+		0.1f * glm::vec3{0.0f, 0.0f, -delta_x}
+	);
+
+	selectBackend();
+	togglePrecision();
+	cycleFormat();
+
+	if (glfwGetKey(window, GLFW_KEY_ESCAPE) == GLFW_PRESS) {
+		return returnCode::QUIT;
+	}
+	return returnCode::CONTINUE;
+}
+
+void GameApp::selectBackend() {
+
+	//number keys pick a backend, in BackendType order
+	for (int i = 0; i < static_cast<int>(BackendType::COUNT); ++i) {
+		if (glfwGetKey(window, GLFW_KEY_1 + i) != GLFW_PRESS) {
+			continue;
+		}
+
+		//only swap once per press, even if the backend falls back
+		BackendType backendType = static_cast<BackendType>(i);
+		if (backendType != requestedBackend) {
+			requestedBackend = backendType;
+			renderer->set_backend(backendType);
+		}
+	}
+}
+
+void GameApp::togglePrecision() {
+
+	//F swaps between float and fixed point rays, once per press
+	bool keyDown = glfwGetKey(window, GLFW_KEY_F) == GLFW_PRESS;
+	if (keyDown && !precisionKeyDown) {
+		renderer->set_precision(renderer->precision == DdaPrecision::FLOAT
+			? DdaPrecision::FIXED : DdaPrecision::FLOAT);
+	}
+	precisionKeyDown = keyDown;
+}
+
+void GameApp::cycleFormat() {
+
+	//P moves on to the next FrameFormat, once per press
+	bool keyDown = glfwGetKey(window, GLFW_KEY_P) == GLFW_PRESS;
+	if (keyDown && !formatKeyDown) {
+		int next = (static_cast<int>(renderer->format) + 1) % (static_cast<int>(FrameFormat::SPANS) + 1);
+		renderer->set_format(static_cast<FrameFormat>(next));
+	}
+	formatKeyDown = keyDown;
+}
+
+void GameApp::mainLoop() {
+
+	returnCode nextAction = returnCode::CONTINUE;
+
+	while (nextAction == returnCode::CONTINUE) {
+
+		renderer->timings.begin(FramePhase::INPUT);
+		nextAction = processInput();
+		glfwPollEvents();
+		renderer->timings.end(FramePhase::INPUT);
+
+		//update
+		renderer->timings.begin(FramePhase::UPDATE);
+		scene->update(frameTime / 16.0f);
+		renderer->timings.end(FramePhase::UPDATE);
+
+		//draw
+		renderer->timings.begin(FramePhase::RENDER);
+		renderer->render(scene);
+		renderer->timings.end(FramePhase::RENDER);
+
+		calculateFrameRate();
+
+	}
+}
+
+GameApp::~GameApp() {
+	//free memory
+	delete scene;
+	delete renderer;
+	glfwTerminate();
+}
+
+void GameApp::calculateFrameRate() {
+	currentTime = glfwGetTime();
+	double delta = currentTime - lastTime;
+
+	if (delta >= 1) {
+		int framerate{ std::max(1, int(numFrames / delta)) };
+		std::stringstream title;
+		title << "Running " << backends::name(renderer->backendType)
+			<< " (" << raycast::precision_name(renderer->precision)
+			<< ", " << drawing::format_name(renderer->format) << ") at " << framerate << " fps. "
+			<< renderer->timings.summary();
+		glfwSetWindowTitle(window, title.str().c_str());
+		lastTime = currentTime;
+		numFrames = -1;
+		frameTime = float(1000.0 / framerate);
+	}
+
+	++numFrames;
+}
\ No newline at end of file
@@ -0,0 +1,35 @@
+#pragma once
+#include "config.h"
+#include "scene.h"
+#include "engine.h"
+
+enum class returnCode {
+	CONTINUE, QUIT
+};
+
+class GameApp {
+public:
+	//backendName: a backend name, or "auto" to keep the fastest
+	GameApp(int width, int height, const std::string& backendName);
+	void mainLoop();
+	~GameApp();
+private:
+	GLFWwindow* makeWindow();
+	returnCode processInput();
+	void selectBackend();
+	void togglePrecision();
+	void cycleFormat();
+	void calculateFrameRate();
+
+	GLFWwindow* window;
+	int width, height;
+	Scene* scene;
+	Engine* renderer;
+	BackendType requestedBackend;
+	bool precisionKeyDown = false;
+	bool formatKeyDown = false;
+
+	double lastTime, currentTime;
+	int numFrames;
+	float frameTime;
+};
\ No newline at end of file
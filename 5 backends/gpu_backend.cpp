@@ -0,0 +1,163 @@
+#include "gpu_backend.h"
+#include "shader.h"
+
+GpuBackend::GpuBackend(int width, int height) {
+
+    raycastDrawShader = util::load_shader("shaders/raycast_vertex.txt", "shaders/raycast_geometry.txt", "shaders/raycast_fragment.txt");
+    raycastComputeShader = util::load_shader("shaders/raycast_compute.txt");
+
+    this->width = width;
+    this->height = height;
+    mapScene = nullptr;
+    mapRevision = -1;
+    glGenVertexArrays(1, &dummyVAO);
+
+    create_resources();
+
+}
+
+GpuBackend::~GpuBackend() {
+    if (mapScene) {
+        glDeleteBuffers(1, &occupancyBuffer);
+        glDeleteBuffers(1, &cellMaterialBuffer);
+    }
+    glDeleteBuffers(1, &materialBuffer);
+    glDeleteBuffers(1, &castBuffer);
+    glDeleteQueries(queryFrames * 3, &timestampQueries[0][0]);
+    glDeleteVertexArrays(1, &dummyVAO);
+    glDeleteProgram(raycastDrawShader);
+    glDeleteProgram(raycastComputeShader);
+}
+
+void GpuBackend::create_resources() {
+
+    //materialBuffer
+    glCreateBuffers(1, &materialBuffer);
+    glBindBuffer(GL_SHADER_STORAGE_BUFFER, materialBuffer);
+    glBufferStorage(GL_SHADER_STORAGE_BUFFER,
+        colors.size() * sizeof(glm::vec4),
+        colors.data(), 0);
+
+    //castBuffer
+    glCreateBuffers(1, &castBuffer);
+    glBindBuffer(GL_SHADER_STORAGE_BUFFER, castBuffer);
+    glBufferStorage(GL_SHADER_STORAGE_BUFFER,
+        width * sizeof(glm::vec4),
+        NULL, 0);
+
+    glUseProgram(raycastComputeShader);
+    glUniform1i(glGetUniformLocation(raycastComputeShader, "screenWidth"), width);
+    glUniform1i(glGetUniformLocation(raycastComputeShader, "screenHeight"), height);
+    cameraPosLocation = glGetUniformLocation(raycastComputeShader, "cameraPos");
+    cameraForwardsLocation = glGetUniformLocation(raycastComputeShader, "cameraForwards");
+    cameraRightLocation = glGetUniformLocation(raycastComputeShader, "cameraRight");
+    fixedPointLocation = glGetUniformLocation(raycastComputeShader, "fixedPoint");
+    fixedPositionLocation = glGetUniformLocation(raycastComputeShader, "fixedPosition");
+    fixedForwardsLocation = glGetUniformLocation(raycastComputeShader, "fixedForwards");
+    fixedRightLocation = glGetUniformLocation(raycastComputeShader, "fixedRight");
+    maxDistanceLocation = glGetUniformLocation(raycastComputeShader, "maxDistance");
+    fogScaleLocation = glGetUniformLocation(raycastComputeShader, "fogScale");
+    fixedMaxDistanceLocation = glGetUniformLocation(raycastComputeShader, "fixedMaxDistance");
+    fixedFogStepLocation = glGetUniformLocation(raycastComputeShader, "fixedFogStep");
+
+    glUseProgram(raycastDrawShader);
+    glUniform1i(glGetUniformLocation(raycastDrawShader, "screenWidth"), width);
+
+    //timestamps
+    glGenQueries(queryFrames * 3, &timestampQueries[0][0]);
+    queryFrame = 0;
+}
+
+void GpuBackend::upload_map(Scene* scene) {
+
+    if (mapScene) {
+        glDeleteBuffers(1, &occupancyBuffer);
+        glDeleteBuffers(1, &cellMaterialBuffer);
+    }
+    mapScene = scene;
+    const MapGrid& map = scene->map;
+    mapRevision = map.revision;
+
+    //occupancyBuffer, the same bits the cpu walks, read as 32 bit words
+    glCreateBuffers(1, &occupancyBuffer);
+    glBindBuffer(GL_SHADER_STORAGE_BUFFER, occupancyBuffer);
+    glBufferStorage(GL_SHADER_STORAGE_BUFFER,
+        map.occupancy.size() * sizeof(uint64_t),
+        map.occupancy.data(), 0);
+
+    //cellMaterialBuffer, a byte per cell, four to a word
+    glCreateBuffers(1, &cellMaterialBuffer);
+    glBindBuffer(GL_SHADER_STORAGE_BUFFER, cellMaterialBuffer);
+    glBufferStorage(GL_SHADER_STORAGE_BUFFER,
+        map.materials.size() / 4 * 4,
+        map.materials.data(), 0);
+
+    glUseProgram(raycastComputeShader);
+    glUniform1i(glGetUniformLocation(raycastComputeShader, "heightInTiles"), map.heightInTiles);
+    glUniform2i(glGetUniformLocation(raycastComputeShader, "mapSize"), map.width, map.height);
+}
+
+void GpuBackend::collect_gpu_timings(int slot, FrameTimer& timings) {
+
+    //never stall the pipeline for a measurement
+    int available = 0;
+    glGetQueryObjectiv(timestampQueries[slot][2], GL_QUERY_RESULT_AVAILABLE, &available);
+    if (!available) {
+        return;
+    }
+
+    GLuint64 timestamps[3];
+    for (int i = 0; i < 3; ++i) {
+        glGetQueryObjectui64v(timestampQueries[slot][i], GL_QUERY_RESULT, &timestamps[i]);
+    }
+    timings.record(FramePhase::CAST, (timestamps[1] - timestamps[0]) * 1e-6);
+    timings.record(FramePhase::DRAW, (timestamps[2] - timestamps[1]) * 1e-6);
+}
+
+void GpuBackend::render(Scene* scene, Framebuffer& framebuffer, FrameTimer& timings) {
+
+    if (scene != mapScene || scene->map.revision != mapRevision) {
+        upload_map(scene);
+    }
+
+    int slot = queryFrame % queryFrames;
+    if (queryFrame >= queryFrames) {
+        collect_gpu_timings(slot, timings);
+    }
+    ++queryFrame;
+
+    //other backends share the context, so bind everything every frame
+    glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 0, occupancyBuffer);
+    glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 3, cellMaterialBuffer);
+    glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 1, materialBuffer);
+    glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 2, castBuffer);
+
+    glQueryCounter(timestampQueries[slot][0], GL_TIMESTAMP);
+    glUseProgram(raycastComputeShader);
+    glUniform3fv(cameraPosLocation, 1, glm::value_ptr(scene->player->position));
+    glUniform3fv(cameraForwardsLocation, 1, glm::value_ptr(scene->player->forwards));
+    glUniform3fv(cameraRightLocation, 1, glm::value_ptr(scene->player->right));
+    glUniform1f(maxDistanceLocation, scene->maxDistance);
+    glUniform1f(fogScaleLocation, raycast::fog_scale(scene));
+
+    //rounded exactly as the cpu backends round it
+    FixedCamera camera(scene);
+    glUniform1i(fixedPointLocation, precision == DdaPrecision::FIXED);
+    glUniform2i(fixedPositionLocation, camera.positionX, camera.positionY);
+    glUniform2i(fixedForwardsLocation, camera.forwardsX, camera.forwardsY);
+    glUniform2i(fixedRightLocation, camera.rightX, camera.rightY);
+    glUniform1i(fixedMaxDistanceLocation, camera.maxDistance);
+    glUniform1i(fixedFogStepLocation, camera.fogStep);
+
+    unsigned int workgroup_count = (width + 63) / 64;
+    glDispatchCompute(workgroup_count, 1, 1);
+    glMemoryBarrier(GL_SHADER_STORAGE_BARRIER_BIT);
+    glQueryCounter(timestampQueries[slot][1], GL_TIMESTAMP);
+
+    glClear(GL_COLOR_BUFFER_BIT);
+    glUseProgram(raycastDrawShader);
+    glBindVertexArray(dummyVAO);
+    glDrawArraysInstanced(GL_POINTS, 0, 1, width);
+    glQueryCounter(timestampQueries[slot][2], GL_TIMESTAMP);
+    glFlush();
+}
\ No newline at end of file
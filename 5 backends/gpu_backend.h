@@ -0,0 +1,50 @@
+#pragma once
+#include "backend.h"
+
+/*
+	Casts every column in a compute shader, then draws the columns
+	straight to the window from a geometry shader. The framebuffer is
+	left untouched.
+
+	In fixed point the shader walks FixedRay's integer DDA from the same
+	FixedCamera, so it hits the same cells with the same wall heights as
+	the cpu backends, though GL still does its own rasterizing.
+*/
+class GpuBackend : public Backend {
+public:
+	GpuBackend(int width, int height);
+	~GpuBackend();
+
+	void render(Scene* scene, Framebuffer& framebuffer, FrameTimer& timings) override;
+	bool presents() override { return true; }
+
+private:
+	void create_resources();
+	void upload_map(Scene* scene);
+	void collect_gpu_timings(int slot, FrameTimer& timings);
+
+	unsigned int raycastComputeShader, raycastDrawShader;
+	unsigned int width, height;
+	unsigned int occupancyBuffer, cellMaterialBuffer, materialBuffer, castBuffer;
+
+	unsigned int cameraPosLocation, cameraForwardsLocation, cameraRightLocation;
+	unsigned int fixedPointLocation, fixedPositionLocation, fixedForwardsLocation, fixedRightLocation;
+	unsigned int maxDistanceLocation, fogScaleLocation, fixedMaxDistanceLocation, fixedFogStepLocation;
+
+	unsigned int dummyVAO;
+
+	//the map is uploaded once per scene, and again whenever it changes
+	Scene* mapScene;
+	int mapRevision;
+
+	//gpu work finishes frames after it's submitted, so timestamps go
+	//round a ring of queries and are read back once they're available
+	static const int queryFrames = 4;
+	unsigned int timestampQueries[queryFrames][3];
+	int queryFrame;
+
+	std::vector<glm::vec4> colors = { glm::vec4(0.0f),
+		glm::vec4(0.0f, 0.0f, 0.5f, 1.0f), glm::vec4(0.0f, 0.5f, 0.0f, 1.0f),
+		glm::vec4(0.0f, 0.5f, 0.5f, 1.0f), glm::vec4(0.5f, 0.0f, 0.0f, 1.0f),
+		glm::vec4(0.5f, 0.0f, 0.5f, 1.0f) };
+};
\ No newline at end of file
@@ -0,0 +1,56 @@
+#include "config.h"
+#include "benchmark.h"
+#ifndef HEADLESS
+#include "game_app.h"
+#endif
+
+#ifdef HEADLESS
+int main() {
+
+	benchmark::write_json(std::cout, benchmark::run());
+	return 0;
+}
+#else
+int main(int argc, char** argv) {
+
+	//a backend name, "auto" to keep the fastest one,
+	//or --benchmark to time every backend without showing a window
+	std::string choice = (argc > 1) ? argv[1] : "auto";
+
+	if (choice == "--benchmark") {
+
+		if (!glfwInit()) {
+			std::cerr << "Couldn't start GLFW" << std::endl;
+			return 1;
+		}
+		glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 4);
+		glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 5);
+		glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
+		glfwWindowHint(GLFW_VISIBLE, GLFW_FALSE);
+		//sized for the largest benchmark resolution
+		GLFWwindow* window = glfwCreateWindow(1920, 1080, "Benchmark", NULL, NULL);
+		if (!window) {
+			//there's no surfaceless context here, so without a display the
+			//gpu work has nowhere to run
+			std::cerr << "Couldn't create an OpenGL 4.5 context" << std::endl;
+			glfwTerminate();
+			return 1;
+		}
+		glfwMakeContextCurrent(window);
+		if (!gladLoadGLLoader((GLADloadproc)glfwGetProcAddress)) {
+			std::cerr << "Couldn't load OpenGL functions" << std::endl;
+			glfwTerminate();
+			return 1;
+		}
+
+		benchmark::write_json(std::cout, benchmark::run());
+
+		glfwTerminate();
+		return 0;
+	}
+
+	GameApp* myApp = new GameApp(800, 600, choice);
+	delete myApp;
+	return 0;
+}
+#endif
\ No newline at end of file
@@ -0,0 +1,168 @@
+#include "map_grid.h"
+
+void MapGrid::build(const int* cells, int width, int height) {
+
+    this->width = width;
+    this->height = height;
+    widthInTiles = (width + tileMask) >> tileShift;
+    tileRowShift = row_shift(height);
+    heightInTiles = 1 << tileRowShift;
+    occupancy.assign(widthInTiles * heightInTiles, 0);
+    materials.assign(cell_count() + 3, 0);
+    clearance.assign(cell_count() + 3, 0);
+    maxClearance = 0;
+
+    for (int x = 0; x < width; ++x) {
+        for (int y = 0; y < height; ++y) {
+            int cell = cell_index(x, y);
+            occupancy[cell >> 6] |= uint64_t(cells[x * height + y] > 0) << (cell & 63);
+            materials[cell] = static_cast<uint8_t>(cells[x * height + y]);
+        }
+    }
+    build_clearance(0, 0, width - 1, height - 1);
+    build_levels();
+    ++revision;
+}
+
+void MapGrid::set(int x, int y, int material) {
+
+    //Only cells whose nearest stop was this cell, or now is, change
+    //clearance, and none of those is further from it than the most
+    //clearance anywhere.
+    int reach = maxClearance + 1;
+
+    int cell = cell_index(x, y);
+    uint64_t& word = occupancy[cell >> 6];
+    uint64_t bit = uint64_t(1) << (cell & 63);
+    word = material > 0 ? word | bit : word & ~bit;
+    materials[cell] = static_cast<uint8_t>(material);
+    build_clearance(x - reach, y - reach, x + reach, y + reach);
+    update_levels(x, y);
+
+    ++revision;
+}
+
+void MapGrid::open_reach(int x, int y, int stepX, int stepY, int& reachX, int& reachY) const {
+
+    reachX = reachY = clearance_at(x, y) - 1;
+
+    for (int level = static_cast<int>(levels.size()) - 1; level >= 0; --level) {
+        if (block_solid(level, x, y)) {
+            continue;
+        }
+
+        //the cells left in the block in the ray's direction
+        int size = 1 << levels[level].shift;
+        int blockX = x & ~(size - 1), blockY = y & ~(size - 1);
+        int blockReachX = stepX > 0 ? blockX + size - 1 - x : x - blockX;
+        int blockReachY = stepY > 0 ? blockY + size - 1 - y : y - blockY;
+        if (std::min(blockReachX, blockReachY) >= reachX) {
+            reachX = blockReachX;
+            reachY = blockReachY;
+        }
+        return;
+    }
+}
+
+void MapGrid::build_levels() {
+
+    //a level whose block would cover the whole map can't tell a ray
+    //anything, so stop below it
+    levels.clear();
+    for (int shift = levelShift; (1 << shift) < std::max(width, height); shift += levelShift) {
+
+        Level blocks;
+        blocks.shift = shift;
+        blocks.width = (width + (1 << shift) - 1) >> shift;
+        blocks.height = (height + (1 << shift) - 1) >> shift;
+        blocks.wordsPerRow = (blocks.height + 63) / 64;
+        blocks.occupancy.assign(blocks.width * blocks.wordsPerRow, 0);
+
+        //each level is built from the one below, the first from the cells
+        int finerWidth = levels.empty() ? width : levels.back().width;
+        int finerHeight = levels.empty() ? height : levels.back().height;
+        for (int x = 0; x < finerWidth; ++x) {
+            for (int y = 0; y < finerHeight; ++y) {
+                bool finerSolid = levels.empty() ? stops(x, y) : block_solid(static_cast<int>(levels.size()) - 1,
+                    x << levels.back().shift, y << levels.back().shift);
+                if (finerSolid) {
+                    int blockX = x >> levelShift, blockY = y >> levelShift;
+                    blocks.occupancy[blockX * blocks.wordsPerRow + (blockY >> 6)] |= uint64_t(1) << (blockY & 63);
+                }
+            }
+        }
+        levels.push_back(std::move(blocks));
+    }
+}
+
+void MapGrid::update_levels(int x, int y) {
+
+    for (size_t level = 0; level < levels.size(); ++level) {
+        Level& blocks = levels[level];
+        int finerShift = level == 0 ? 0 : levels[level - 1].shift;
+        int finerWidth = level == 0 ? width : levels[level - 1].width;
+        int finerHeight = level == 0 ? height : levels[level - 1].height;
+
+        //the finer cells or blocks under the one block holding (x, y)
+        int blockX = x >> blocks.shift, blockY = y >> blocks.shift;
+        int firstX = blockX << levelShift, firstY = blockY << levelShift;
+        int lastX = std::min(firstX + (1 << levelShift), finerWidth);
+        int lastY = std::min(firstY + (1 << levelShift), finerHeight);
+        bool solid = false;
+        for (int finerX = firstX; finerX < lastX && !solid; ++finerX) {
+            for (int finerY = firstY; finerY < lastY && !solid; ++finerY) {
+                solid = level == 0 ? stops(finerX, finerY)
+                    : block_solid(static_cast<int>(level) - 1, finerX << finerShift, finerY << finerShift);
+            }
+        }
+
+        uint64_t& word = blocks.occupancy[blockX * blocks.wordsPerRow + (blockY >> 6)];
+        uint64_t bit = uint64_t(1) << (blockY & 63);
+        word = solid ? word | bit : word & ~bit;
+    }
+}
+
+void MapGrid::build_clearance(int minX, int minY, int maxX, int maxY) {
+
+    minX = std::max(minX, 0);
+    minY = std::max(minY, 0);
+    maxX = std::min(maxX, width - 1);
+    maxY = std::min(maxY, height - 1);
+
+    //the edge of the map stops rays, so no ray ever skips off it
+    for (int x = minX; x <= maxX; ++x) {
+        for (int y = minY; y <= maxY; ++y) {
+            int edge = std::min({ x, y, width - 1 - x, height - 1 - y, 255 });
+            clearance[cell_index(x, y)] = solid(x, y) ? 0 : static_cast<uint8_t>(edge);
+        }
+    }
+
+    //Two chamfer passes, with all eight neighbours one step away, give
+    //the exact Chebyshev distance. Neighbours outside the window already
+    //have theirs, and pass it in like any other.
+    auto relax = [this](int x, int y, int dx, int dy) {
+        int nx = x + dx, ny = y + dy;
+        if (nx < 0 || nx >= width || ny < 0 || ny >= height) {
+            return;
+        }
+        uint8_t& cell = clearance[cell_index(x, y)];
+        cell = static_cast<uint8_t>(std::min<int>(cell, clearance[cell_index(nx, ny)] + 1));
+    };
+    for (int x = minX; x <= maxX; ++x) {
+        for (int y = minY; y <= maxY; ++y) {
+            relax(x, y, -1, -1);
+            relax(x, y, -1, 0);
+            relax(x, y, -1, 1);
+            relax(x, y, 0, -1);
+        }
+    }
+    for (int x = maxX; x >= minX; --x) {
+        for (int y = maxY; y >= minY; --y) {
+            relax(x, y, 1, 1);
+            relax(x, y, 1, 0);
+            relax(x, y, 1, -1);
+            relax(x, y, 0, 1);
+            maxClearance = std::max<int>(maxClearance, clearance[cell_index(x, y)]);
+        }
+    }
+}
\ No newline at end of file
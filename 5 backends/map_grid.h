@@ -0,0 +1,143 @@
+#pragma once
+#include "config.h"
+
+//The map as the rays see it: a solid bit, a material byte and a
+//clearance byte per cell, stored in 8 x 8 tiles so a step along
+//either axis usually stays in the same tile. Rays stop in walls and
+//on the edge of the map, jump across open floor by clearance, and
+//across huge empty regions by the block pyramid in levels.
+class MapGrid {
+public:
+	//cells is width x height ints, zero for empty
+	void build(const int* cells, int width, int height);
+	void set(int x, int y, int material);
+
+	//cells in every plane, counting the padding
+	int cell_count() const {
+		return widthInTiles * heightInTiles << (2 * tileShift);
+	}
+	//where cell (x, y) lives in each plane: its bit in occupancy, its
+	//byte in materials and clearance
+	int cell_index(int x, int y) const {
+		return cell_index_at(x, y, tileRowShift);
+	}
+	//the same, given tileRowShift, for walks that know it up front
+	int cell_index_at(int x, int y, int rowShift) const {
+		int tile = ((x >> tileShift) << rowShift) + (y >> tileShift);
+		int inTile = ((x & tileMask) << tileShift) | (y & tileMask);
+		return (tile << (2 * tileShift)) | inTile;
+	}
+	//tileRowShift for a map height cells tall
+	static constexpr int row_shift(int height) {
+		int shift = 0;
+		while ((1 << (shift + tileShift)) < height) {
+			++shift;
+		}
+		return shift;
+	}
+
+	bool solid(int x, int y) const {
+		int cell = cell_index(x, y);
+		return (occupancy[cell >> 6] >> (cell & 63)) & 1;
+	}
+	//does a ray stop in cell (x, y)?
+	bool stops(int x, int y) const {
+		return solid(x, y) || x == 0 || y == 0 || x == width - 1 || y == height - 1;
+	}
+	int material(int x, int y) const {
+		return materials[cell_index(x, y)];
+	}
+	int clearance_at(int x, int y) const {
+		return clearance[cell_index(x, y)];
+	}
+	//how many crossings a ray in cell (x, y), heading along stepX and
+	//stepY, can take on each axis without leaving empty space: its
+	//clearance square, or the coarsest empty block around it when that
+	//reaches further
+	void open_reach(int x, int y, int stepX, int stepY, int& reachX, int& reachY) const;
+
+	//does the level's block holding cell (x, y) have any wall in it?
+	bool block_solid(int level, int x, int y) const {
+		const Level& blocks = levels[level];
+		x >>= blocks.shift;
+		y >>= blocks.shift;
+		return (blocks.occupancy[x * blocks.wordsPerRow + (y >> 6)] >> (y & 63)) & 1;
+	}
+
+	//rays only jump from cells with more clearance than this
+	static const int jumpClearance = 32;
+
+	//tiles are 1 << tileShift cells on a side, so one tile's bits fill
+	//a word
+	static const int tileShift = 3;
+	static const int tileMask = (1 << tileShift) - 1;
+
+	int width = 0, height = 0;
+	//bumped whenever a cell changes, so anything kept from earlier
+	//frames knows to go
+	int revision = 0;
+	//heightInTiles is 1 << tileRowShift, counting the padding
+	int widthInTiles = 0, heightInTiles = 0;
+	int tileRowShift = 0;
+	//one word per tile
+	std::vector<uint64_t> occupancy;
+	//padded so a 4 byte read at the last cell stays inside
+	std::vector<uint8_t> materials;
+	//padded like materials
+	std::vector<uint8_t> clearance;
+	//no cell has more clearance than this, though walls set since the
+	//build may have left less
+	int maxClearance = 0;
+
+	//one pyramid level, blocks are 1 << shift cells on a side
+	struct Level {
+		int shift;
+		int width, height;
+		int wordsPerRow;
+		std::vector<uint64_t> occupancy;
+	};
+	//finest first
+	std::vector<Level> levels;
+	static const int levelShift = 3;
+
+private:
+	//clearance for the cells from (minX, minY) to (maxX, maxY), given
+	//right clearance everywhere else
+	void build_clearance(int minX, int minY, int maxX, int maxY);
+	void build_levels();
+	//the pyramid blocks over cell (x, y), after it changed
+	void update_levels(int x, int y);
+};
+
+/*
+	What a walk knows about the map's size before it starts. The shape
+	finds cells for it, so a walk written against one is compiled once
+	for maps of any size and once more for each size worth specialising.
+
+	RuntimeShape reads the size off the map, for any map at all, like
+	one loaded from disk. StaticShape<Width, Height> fixes it at compile
+	time, so the tile stride is a constant shift, and only fits maps of
+	just that size.
+*/
+struct RuntimeShape {
+	static const bool isStatic = false;
+
+	static bool fits(const MapGrid&) { return true; }
+	static int cell_index(const MapGrid& map, int x, int y) {
+		return map.cell_index(x, y);
+	}
+};
+
+template <int Width, int Height>
+struct StaticShape {
+	static const bool isStatic = true;
+	static const int width = Width, height = Height;
+	static const int tileRowShift = MapGrid::row_shift(Height);
+
+	static bool fits(const MapGrid& map) {
+		return map.width == Width && map.height == Height;
+	}
+	static int cell_index(const MapGrid& map, int x, int y) {
+		return map.cell_index_at(x, y, tileRowShift);
+	}
+};
\ No newline at end of file
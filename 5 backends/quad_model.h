@@ -0,0 +1,11 @@
+#pragma once
+#include "config.h"
+
+class QuadModel {
+public:
+	unsigned int VBO, VAO, vertexCount;
+	std::vector<float> vertices;
+
+	QuadModel();
+	~QuadModel();
+};
\ No newline at end of file
@@ -0,0 +1,356 @@
+#include "raycast.h"
+
+const uint32_t raycast::colors[6] = {
+    static_cast<uint32_t>(0),
+    static_cast<uint32_t>((0 << 24) + (0 << 16) + (128 << 8) + 255),
+    static_cast<uint32_t>((0 << 24) + (128 << 16) + (0 << 8) + 255),
+    static_cast<uint32_t>((0 << 24) + (128 << 16) + (128 << 8) + 255),
+    static_cast<uint32_t>((128 << 24) + (0 << 16) + (0 << 8) + 255),
+    static_cast<uint32_t>((128 << 24) + (0 << 16) + (128 << 8) + 255)
+};
+
+//cast_column, finding cells as Shape does
+template <typename Shape>
+static ColumnHit cast_column_in(Scene* scene, int x, int width, int height) {
+
+    const MapGrid& map = scene->map;
+    float cameraX = 2 * x / (float)width - 1;
+    float rayDirX = scene->player->forwards.x + scene->player->right.x * cameraX;
+    float rayDirY = scene->player->forwards.y + scene->player->right.y * cameraX;
+    //which box of the map we're in
+    int mapX = int(scene->player->position.x);
+    int mapY = int(scene->player->position.y);
+
+    //length of ray from current position to next x or y-side
+    float sideDistX;
+    float sideDistY;
+
+    float deltaDistX = (rayDirX == 0) ? 1e30 : std::abs(1 / rayDirX);
+    float deltaDistY = (rayDirY == 0) ? 1e30 : std::abs(1 / rayDirY);
+
+    float perpWallDist;
+
+    //what direction to step in x or y-direction (either +1 or -1)
+    int stepX;
+    int stepY;
+
+    int steps = 0;
+    int hit = 0; //was there a wall hit?
+    int side; //was a NS or a EW wall hit?
+    //calculate step and initial sideDist
+    if (rayDirX < 0)
+    {
+        stepX = -1;
+        sideDistX = (scene->player->position.x - mapX) * deltaDistX;
+    }
+    else
+    {
+        stepX = 1;
+        sideDistX = (mapX + 1.0 - scene->player->position.x) * deltaDistX;
+    }
+    if (rayDirY < 0)
+    {
+        stepY = -1;
+        sideDistY = (scene->player->position.y - mapY) * deltaDistY;
+    }
+    else
+    {
+        stepY = 1;
+        sideDistY = (mapY + 1.0 - scene->player->position.y) * deltaDistY;
+    }
+    //perform DDA
+    while (hit == 0)
+    {
+        //jump to next map square, either in x-direction, or in y-direction
+        if (sideDistX < sideDistY)
+        {
+            sideDistX += deltaDistX;
+            mapX += stepX;
+            side = 0;
+        }
+        else
+        {
+            sideDistY += deltaDistY;
+            mapY += stepY;
+            side = 1;
+        }
+        ++steps;
+        //Check if ray has hit a wall, walls have no clearance
+        int clearance = map.clearance[Shape::cell_index(map, mapX, mapY)];
+        if (clearance == 0) hit = 1;
+        //or if it's about to go out of sight
+        else if (std::min(sideDistX, sideDistY) > scene->maxDistance) break;
+        else if (clearance > MapGrid::jumpClearance)
+        {
+            //take every crossing before the ray leaves the empty space
+            //around this cell in one go. Ties go to y, as in the steps.
+            int openX, openY;
+            map.open_reach(mapX, mapY, stepX, stepY, openX, openY);
+            float reachX = static_cast<float>(openX);
+            float reachY = static_cast<float>(openY);
+            float exitDist = std::min(sideDistX + reachX * deltaDistX, sideDistY + reachY * deltaDistY);
+            float crossingsX = std::clamp(std::ceil((exitDist - sideDistX) / deltaDistX), 0.0f, reachX);
+            float crossingsY = std::clamp(std::floor((exitDist - sideDistY) / deltaDistY) + 1.0f, 0.0f, reachY);
+            sideDistX += crossingsX * deltaDistX;
+            sideDistY += crossingsY * deltaDistY;
+            mapX += stepX * static_cast<int>(crossingsX);
+            mapY += stepY * static_cast<int>(crossingsY);
+            steps += static_cast<int>(crossingsX + crossingsY);
+        }
+    }
+    if (side == 0) perpWallDist = (sideDistX - deltaDistX);
+    else          perpWallDist = (sideDistY - deltaDistY);
+
+    //the ray gave up, or stopped at the open edge of the map, or jumped
+    //onto a wall out of sight
+    int material = map.material(mapX, mapY);
+    if (material == 0 || perpWallDist > scene->maxDistance) {
+        return raycast::sky(height, steps);
+    }
+
+    //Calculate height of line to draw on screen
+    int lineHeight = (int)(height / perpWallDist);
+
+    //calculate lowest and highest pixel to fill in current stripe
+    ColumnHit column;
+    column.drawStart = -lineHeight / 2 + height / 2;
+    if (column.drawStart < 0) column.drawStart = 0;
+    column.drawEnd = lineHeight / 2 + height / 2;
+    if (column.drawEnd >= height) column.drawEnd = height - 1;
+
+    //choose wall color
+    int color = raycast::colors[material];
+
+    //give x and y sides different brightness
+    if (side == 1) {
+        color = color >> 1;
+    }
+
+    //and fade it into the fog
+    int fog = static_cast<int>(std::min(256.0f, std::max(0.0f, (scene->maxDistance - perpWallDist) * raycast::fog_scale(scene))));
+    column.color = raycast::fade(color, fog);
+    column.paletteIndex = raycast::palette_index(material, side, fog);
+    column.steps = steps;
+
+    return column;
+}
+
+ColumnHit raycast::cast_column(Scene* scene, int x, int width, int height) {
+
+    ColumnHit column;
+    with_map_shape(scene->map, [&](auto shape) {
+        column = cast_column_in<decltype(shape)>(scene, x, width, height);
+    });
+    return column;
+}
+ColumnHit raycast::cast_column_fixed(Scene* scene, int x, int width, int height) {
+
+    FixedCamera camera(scene);
+    FixedRay ray;
+    ray.aim(camera, x, width);
+    ray.walk(scene->map, camera.maxDistance);
+    return ray.resolve(scene->map, camera, height);
+}
+
+ColumnHit raycast::sky(int height, int steps) {
+
+    ColumnHit column;
+    column.drawStart = height / 2;
+    column.drawEnd = height / 2 - 1;
+    column.color = 0;
+    column.paletteIndex = 0;
+    column.steps = steps;
+    return column;
+}
+
+uint32_t raycast::fade(uint32_t color, int factor) {
+
+    //two channels at a time, each with room to multiply
+    uint32_t evenChannels = (((color & 0x00ff00ffu) * factor) >> 8) & 0x00ff00ffu;
+    uint32_t oddChannels = (((color >> 8) & 0x00ff00ffu) * factor) & 0xff00ff00u;
+    return evenChannels | oddChannels;
+}
+
+float raycast::fog_scale(const Scene* scene) {
+    return 256.0f / std::max(scene->maxDistance - scene->fogStart, 1.0f / 256);
+}
+
+int raycast::palette_index(int material, int side, int fog) {
+    //the nearest fog step
+    int level = (fog * (fogLevels - 1) + 128) >> 8;
+    return 1 + ((material - 1) * 2 + side) * fogLevels + level;
+}
+
+void raycast::build_palette(uint32_t* entries) {
+
+    std::fill(entries, entries + paletteSize, 0);
+    for (int material = 1; material < 6; ++material) {
+        for (int side = 0; side < 2; ++side) {
+            //darkened as the casts do it, sign and all
+            uint32_t color = static_cast<int>(colors[material]) >> side;
+            for (int level = 0; level < fogLevels; ++level) {
+                int fog = (level * 256 + (fogLevels - 1) / 2) / (fogLevels - 1);
+                entries[palette_index(material, side, fog)] = fade(color, fog);
+            }
+        }
+    }
+}
+
+ColumnCaster raycast::caster(DdaPrecision precision) {
+    return precision == DdaPrecision::FIXED ? cast_column_fixed : cast_column;
+}
+
+const char* raycast::precision_name(DdaPrecision precision) {
+    return precision == DdaPrecision::FIXED ? "fixed" : "float";
+}
+
+int32_t fixed::from_float(float value) {
+    return static_cast<int32_t>(std::lround(value * one));
+}
+
+//16.16 times 16.16, both operands at most 2^31
+static int32_t multiply(int32_t a, int32_t b) {
+    return static_cast<int32_t>((static_cast<int64_t>(a) * b) >> fixed::fractionBits);
+}
+
+FixedCamera::FixedCamera(const Scene* scene) {
+    const Player* player = scene->player;
+    positionX = fixed::from_float(player->position.x);
+    positionY = fixed::from_float(player->position.y);
+    forwardsX = fixed::from_float(player->forwards.x);
+    forwardsY = fixed::from_float(player->forwards.y);
+    rightX = fixed::from_float(player->right.x);
+    rightY = fixed::from_float(player->right.y);
+
+    //no further than a ray can go
+    maxDistance = fixed::from_float(std::min(scene->maxDistance, static_cast<float>(fixed::maxMapSize * 2)));
+    fogStep = std::max(1, (maxDistance - fixed::from_float(scene->fogStart)) >> 8);
+}
+
+void FixedRay::aim(const FixedCamera& camera, int x, int width) {
+
+    //-1 to 1 across the screen. Unsigned division rounds the same way
+    //everywhere, the compute shader included.
+    int32_t cameraX = static_cast<int32_t>((static_cast<uint32_t>(2 * x) << fixed::fractionBits)
+        / static_cast<uint32_t>(width)) - fixed::one;
+    rayDirX = camera.forwardsX + multiply(camera.rightX, cameraX);
+    rayDirY = camera.forwardsY + multiply(camera.rightY, cameraX);
+
+    //which box of the map we're in
+    mapX = camera.positionX >> fixed::fractionBits;
+    mapY = camera.positionY >> fixed::fractionBits;
+
+    //1 / |rayDir|, capped for rays (almost) parallel to an axis
+    uint32_t lengthX = static_cast<uint32_t>(std::abs(rayDirX));
+    uint32_t lengthY = static_cast<uint32_t>(std::abs(rayDirY));
+    deltaDistX = lengthX == 0 ? fixed::farAway : static_cast<int32_t>(std::min<uint32_t>(0xffffffffu / lengthX, fixed::farAway));
+    deltaDistY = lengthY == 0 ? fixed::farAway : static_cast<int32_t>(std::min<uint32_t>(0xffffffffu / lengthY, fixed::farAway));
+
+    //calculate step and initial sideDist
+    int32_t fractionX = camera.positionX & (fixed::one - 1);
+    int32_t fractionY = camera.positionY & (fixed::one - 1);
+    stepX = rayDirX < 0 ? -1 : 1;
+    sideDistX = multiply(rayDirX < 0 ? fractionX : fixed::one - fractionX, deltaDistX);
+    stepY = rayDirY < 0 ? -1 : 1;
+    sideDistY = multiply(rayDirY < 0 ? fractionY : fixed::one - fractionY, deltaDistY);
+
+    side = 0;
+    steps = 0;
+}
+
+void FixedRay::step() {
+
+    //jump to next map square, either in x-direction, or in y-direction
+    if (sideDistX < sideDistY) {
+        sideDistX += deltaDistX;
+        mapX += stepX;
+        side = 0;
+    }
+    else {
+        sideDistY += deltaDistY;
+        mapY += stepY;
+        side = 1;
+    }
+    ++steps;
+}
+
+void FixedRay::walk(const MapGrid& map, int32_t maxDistance) {
+    with_map_shape(map, [&](auto shape) {
+        walk_in<decltype(shape)>(map, maxDistance);
+    });
+}
+
+template <typename Shape>
+void FixedRay::walk_in(const MapGrid& map, int32_t maxDistance) {
+
+    //perform DDA
+    while (true) {
+        step();
+
+        //Check if ray has hit a wall, walls have no clearance, or is
+        //about to go out of sight
+        int clearance = map.clearance[Shape::cell_index(map, mapX, mapY)];
+        if (clearance == 0) break;
+        if (std::min(sideDistX, sideDistY) > maxDistance) break;
+        if (clearance > MapGrid::jumpClearance) {
+            int reachX, reachY;
+            map.open_reach(mapX, mapY, stepX, stepY, reachX, reachY);
+            jump(reachX, reachY);
+        }
+    }
+}
+
+void FixedRay::jump(int reachX, int reachY) {
+
+    //the first crossing out of the reach, and every crossing before it.
+    //Exact, so this lands where stepping would have.
+    int64_t exitDist = std::min(sideDistX + static_cast<int64_t>(reachX) * deltaDistX,
+        sideDistY + static_cast<int64_t>(reachY) * deltaDistY);
+    int64_t crossingsX = exitDist <= sideDistX ? 0
+        : std::min<int64_t>(reachX, (exitDist - sideDistX + deltaDistX - 1) / deltaDistX);
+    int64_t crossingsY = exitDist < sideDistY ? 0
+        : std::min<int64_t>(reachY, (exitDist - sideDistY) / deltaDistY + 1);
+
+    sideDistX = static_cast<int32_t>(sideDistX + crossingsX * deltaDistX);
+    sideDistY = static_cast<int32_t>(sideDistY + crossingsY * deltaDistY);
+    mapX += stepX * static_cast<int>(crossingsX);
+    mapY += stepY * static_cast<int>(crossingsY);
+    steps += static_cast<int>(crossingsX + crossingsY);
+}
+
+ColumnHit FixedRay::resolve(const MapGrid& map, const FixedCamera& camera, int height) const {
+
+    //the ray gave up, or stopped at the open edge of the map, or landed
+    //on a wall out of sight
+    int32_t perpWallDist = side == 0 ? sideDistX - deltaDistX : sideDistY - deltaDistY;
+    int material = map.material(mapX, mapY);
+    if (material == 0 || perpWallDist > camera.maxDistance) {
+        return raycast::sky(height, steps);
+    }
+    perpWallDist = std::max(1, perpWallDist);
+
+    //Calculate height of line to draw on screen, capped for a camera
+    //right up against a wall
+    int lineHeight = static_cast<int>(std::min<uint32_t>(
+        (static_cast<uint32_t>(height) << fixed::fractionBits) / static_cast<uint32_t>(perpWallDist), 1u << 24));
+
+    //calculate lowest and highest pixel to fill in current stripe
+    ColumnHit column;
+    column.drawStart = -lineHeight / 2 + height / 2;
+    if (column.drawStart < 0) column.drawStart = 0;
+    column.drawEnd = lineHeight / 2 + height / 2;
+    if (column.drawEnd >= height) column.drawEnd = height - 1;
+
+    //choose wall color, giving x and y sides different brightness, and
+    //fade it into the fog
+    int color = raycast::colors[material];
+    if (side == 1) {
+        color = color >> 1;
+    }
+    int fog = std::clamp((camera.maxDistance - perpWallDist) / camera.fogStep, 0, 256);
+    column.color = raycast::fade(color, fog);
+    column.paletteIndex = raycast::palette_index(material, side, fog);
+    column.steps = steps;
+
+    return column;
+}
\ No newline at end of file
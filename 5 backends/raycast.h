@@ -0,0 +1,117 @@
+#pragma once
+#include "config.h"
+#include "scene.h"
+
+//What one screen column shows: a single wall span, empty for sky
+struct ColumnHit {
+	int drawStart, drawEnd;
+	uint32_t color;
+	//the nearest raycast::palette entry to color, for indexed frames
+	int paletteIndex;
+	//DDA steps the ray took to get there, a measure of its cost
+	int steps;
+};
+
+//How rays keep track of their distance along the map
+enum class DdaPrecision {
+	//floats, each backend rounding its own way
+	FLOAT,
+	//16.16 fixed point, the same frame from every backend
+	FIXED
+};
+
+/*
+	The player's view in 16.16 fixed point. Everything after this
+	rounding is integer arithmetic, so every backend that starts from the
+	same camera walks the same cells and draws the same spans.
+*/
+struct FixedCamera {
+	FixedCamera() {}
+	FixedCamera(const Scene* scene);
+
+	int32_t positionX, positionY;
+	int32_t forwardsX, forwardsY;
+	int32_t rightX, rightY;
+	//Scene::maxDistance, and the distance over which the fog thickens
+	//by one 256th
+	int32_t maxDistance;
+	int32_t fogStep;
+};
+
+/*
+	One ray of the fixed point DDA. Side distances are 16.16 and stay
+	below 2^31 on maps up to fixed::maxMapSize cells on a side: the
+	longest ray crosses the diagonal, under 2^30, and an axis the ray
+	barely moves along is capped at fixed::farAway.
+
+	The packet kernels step these in integer lanes but set them up,
+	jump them and resolve them through these same functions, so the
+	results can't drift apart.
+*/
+struct FixedRay {
+	//start the ray from the camera through screen column x
+	void aim(const FixedCamera& camera, int x, int width);
+	//one crossing, ties go to y
+	void step();
+	//step until the ray stands somewhere it stops, or its next crossing
+	//is past maxDistance, jumping across open floor
+	void walk(const MapGrid& map, int32_t maxDistance);
+	//walk, finding cells as Shape does
+	template <typename Shape>
+	void walk_in(const MapGrid& map, int32_t maxDistance);
+	//take reachX crossings along x and reachY along y, as many of each
+	//as the steps would have taken before leaving that reach
+	void jump(int reachX, int reachY);
+	//the wall span for the cell the ray stands in, or sky if that's no
+	//wall or it's out of sight
+	ColumnHit resolve(const MapGrid& map, const FixedCamera& camera, int height) const;
+
+	//as aimed, so rays can be put in angle order
+	int32_t rayDirX, rayDirY;
+	int mapX, mapY;
+	int stepX, stepY;
+	int32_t deltaDistX, deltaDistY;
+	int32_t sideDistX, sideDistY;
+	int side;
+	int steps;
+};
+
+namespace fixed {
+	const int fractionBits = 16;
+	const int32_t one = 1 << fractionBits;
+	//delta distance for an axis the ray (almost) doesn't move along
+	const int32_t farAway = (1 << 30) - 1;
+	const int maxMapSize = 8192;
+
+	int32_t from_float(float value);
+}
+
+//Casts one screen column
+typedef ColumnHit (*ColumnCaster)(Scene* scene, int x, int width, int height);
+
+namespace raycast {
+
+	extern const uint32_t colors[6];
+
+	//the span a column of sky draws
+	ColumnHit sky(int height, int steps);
+	//color, keeping factor 256ths of each channel
+	uint32_t fade(uint32_t color, int factor);
+	//fog factor per unit of distance, as the float casts work it out
+	float fog_scale(const Scene* scene);
+
+	//Indexed frames hold one byte a pixel, an entry of the palette: sky
+	//first, then every material and side at fogLevels steps of fog
+	const int paletteSize = 256;
+	const int fogLevels = 25;
+	//the entry for a wall of material, seen side on, with fog 256ths of
+	//its color left
+	int palette_index(int material, int side, int fog);
+	void build_palette(uint32_t* entries);
+
+	ColumnHit cast_column(Scene* scene, int x, int width, int height);
+	ColumnHit cast_column_fixed(Scene* scene, int x, int width, int height);
+
+	ColumnCaster caster(DdaPrecision precision);
+	const char* precision_name(DdaPrecision precision);
+}
\ No newline at end of file
@@ -0,0 +1,45 @@
+#include "scene.h"
+
+Scene::Scene() {
+
+	PlayerCreateInfo playerInfo;
+	playerInfo.eulers = { 0.0f, 90.0f, 180.0f };
+	playerInfo.position = { 22.0f, 12.0f, 0.0f };
+	player = new Player(&playerInfo);
+
+	map.build(&worldMap[0][0], sizeof(worldMap) / sizeof(worldMap[0]), sizeof(worldMap[0]) / sizeof(int));
+
+}
+
+Scene::~Scene() {
+	delete player;
+}
+
+void Scene::update(float rate) {
+
+	player->update();
+}
+
+void Scene::movePlayer(glm::vec3 dPos) {
+
+	if (!map.solid(int(player->position.x +  dPos.x), int(player->position.y))) {
+		player->position.x += dPos.x;
+	}
+	if (!map.solid(int(player->position.x), int(player->position.y + dPos.y))) {
+		player->position.y += dPos.y;
+	}
+
+}
+
+void Scene::spinPlayer(glm::vec3 dEulers) {
+	player->eulers += dEulers;
+
+	if (player->eulers.z < 0) {
+		player->eulers.z += 360;
+	}
+	else if (player->eulers.z > 360) {
+		player->eulers.z -= 360;
+	}
+
+	player->eulers.y = std::max(std::min(player->eulers.y, 179.0f), 1.0f);
+}
\ No newline at end of file
@@ -0,0 +1,79 @@
+#include "simd.h"
+#include "environment.h"
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+const char* simd::name(SimdIsa isa) {
+    switch (isa) {
+    case SimdIsa::SCALAR:
+        return "scalar";
+    case SimdIsa::SSE41:
+        return "sse4.1";
+    case SimdIsa::AVX2:
+        return "avx2";
+    case SimdIsa::AVX512:
+        return "avx512";
+    default:
+        return "unknown";
+    }
+}
+
+bool simd::supported(SimdIsa isa) {
+#ifdef _MSC_VER
+    int info[4];
+    __cpuid(info, 1);
+    bool sse41 = info[2] & (1 << 19);
+    bool fma = info[2] & (1 << 12);
+    bool osxsave = info[2] & (1 << 27);
+    unsigned long long savedState = osxsave ? _xgetbv(0) : 0;
+    __cpuidex(info, 7, 0);
+    bool avx2 = info[1] & (1 << 5);
+    bool avx512 = info[1] & (1 << 16);
+
+    switch (isa) {
+    case SimdIsa::SCALAR:
+        return true;
+    case SimdIsa::SSE41:
+        return sse41;
+    case SimdIsa::AVX2:
+        return avx2 && fma && (savedState & 0x06) == 0x06;
+    case SimdIsa::AVX512:
+        return avx512 && (savedState & 0xe6) == 0xe6;
+    default:
+        return false;
+    }
+#else
+    switch (isa) {
+    case SimdIsa::SCALAR:
+        return true;
+    case SimdIsa::SSE41:
+        return __builtin_cpu_supports("sse4.1");
+    case SimdIsa::AVX2:
+        return __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma");
+    case SimdIsa::AVX512:
+        return __builtin_cpu_supports("avx512f");
+    default:
+        return false;
+    }
+#endif
+}
+
+SimdIsa simd::widest() {
+
+    //lets one machine compare the narrower kernels
+    int limit = static_cast<int>(SimdIsa::COUNT) - 1;
+    std::string requested = environment::variable("RAYCAST_SIMD");
+    for (int i = 0; i < static_cast<int>(SimdIsa::COUNT); ++i) {
+        if (requested == name(static_cast<SimdIsa>(i))) {
+            limit = i;
+        }
+    }
+
+    for (int i = limit; i > 0; --i) {
+        if (supported(static_cast<SimdIsa>(i))) {
+            return static_cast<SimdIsa>(i);
+        }
+    }
+    return SimdIsa::SCALAR;
+}
\ No newline at end of file
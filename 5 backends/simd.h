@@ -0,0 +1,27 @@
+#pragma once
+#include "config.h"
+
+//Instruction sets the packet kernels are built for, narrowest first
+enum class SimdIsa {
+	SCALAR,
+	SSE41,
+	AVX2,
+	AVX512,
+	COUNT
+};
+
+//Lets a single function use instructions the rest of the build doesn't
+//assume. MSVC always allows intrinsics, so there it's empty.
+#if defined(__GNUC__) || defined(__clang__)
+#define SIMD_TARGET(isa) __attribute__((target(isa)))
+#else
+#define SIMD_TARGET(isa)
+#endif
+
+namespace simd {
+	const char* name(SimdIsa isa);
+	//checks the cpu and the operating system, which has to save the wider registers
+	bool supported(SimdIsa isa);
+	//widest supported set, capped by the RAYCAST_SIMD environment variable if it's set
+	SimdIsa widest();
+}
\ No newline at end of file
@@ -0,0 +1,107 @@
+#include "simd_raycast.h"
+#include "simd_raycast_kernel.h"
+#include "simd_raycast_fixed.h"
+
+//One lane, for machines with none of the vector extensions
+struct ScalarLanes {
+    static const int width = 1;
+    typedef float Float;
+    typedef int Int;
+    typedef bool Mask;
+
+    static Float set(float value) { return value; }
+    static Float iota() { return 0.0f; }
+    static Float load(const float* in) { return *in; }
+    static void store(float* out, Float a) { *out = a; }
+    static Int load_int(const int* in) { return *in; }
+    static void store_int(int* out, Int a) { *out = a; }
+
+    static Float add(Float a, Float b) { return a + b; }
+    static Float sub(Float a, Float b) { return a - b; }
+    static Float mul(Float a, Float b) { return a * b; }
+    static Float div(Float a, Float b) { return a / b; }
+    static Float fmadd(Float a, Float b, Float c) { return a * b + c; }
+    static Float abs(Float a) { return std::abs(a); }
+    static Float min(Float a, Float b) { return std::min(a, b); }
+    static Float max(Float a, Float b) { return std::max(a, b); }
+
+    static Mask less(Float a, Float b) { return a < b; }
+    static Mask equal(Float a, Float b) { return a == b; }
+    static bool all(Mask mask) { return mask; }
+    static Mask either(Mask a, Mask b) { return a || b; }
+    static int bits(Mask mask) { return mask ? 1 : 0; }
+    static Mask from_bits(int bits) { return bits & 1; }
+    static Float select(Mask mask, Float a, Float b) { return mask ? a : b; }
+    static Float floor(Float a) { return std::floor(a); }
+    static Int truncate(Float a) { return static_cast<int>(a); }
+    static Float convert(Int a) { return static_cast<float>(a); }
+
+    static Int gather(const int* base, Int index) { return base[index]; }
+    static Int gather_byte(const uint8_t* base, Int index) { return base[index]; }
+    static Mask is_zero(Int a) { return a == 0; }
+    static Mask less_int(Int a, Int b) { return a < b; }
+    static Int set_int(int value) { return value; }
+    static Int add_int(Int a, Int b) { return a + b; }
+    static Int mul_int(Int a, Int b) { return static_cast<int>(static_cast<uint32_t>(a) * static_cast<uint32_t>(b)); }
+    static Int and_int(Int a, Int b) { return a & b; }
+    static Int or_int(Int a, Int b) { return a | b; }
+    static Int shift_left(Int a, int count) { return a << count; }
+    static Int shift_right(Int a, int count) { return a >> count; }
+    static Int select_int(Mask mask, Int a, Int b) { return mask ? a : b; }
+};
+
+void simd_raycast::cast_packet_scalar(Scene* scene, int x, int width, int height, ColumnHit* hits) {
+    with_map_shape(scene->map, [&](auto shape) {
+        cast_packet<ScalarLanes, decltype(shape)>(scene, x, width, height, hits);
+    });
+}
+
+void simd_raycast::cast_stream_scalar(Scene* scene, int startX, int endX, int width, int height, ColumnHit* columns) {
+    with_map_shape(scene->map, [&](auto shape) {
+        cast_stream<ScalarLanes, decltype(shape)>(scene, startX, endX, width, height, columns);
+    });
+}
+
+void simd_raycast::cast_packet_fixed_scalar(Scene* scene, int x, int width, int height, ColumnHit* hits) {
+    with_map_shape(scene->map, [&](auto shape) {
+        cast_packet_fixed<ScalarLanes, decltype(shape)>(scene, x, width, height, hits);
+    });
+}
+
+void simd_raycast::cast_stream_fixed_scalar(Scene* scene, int startX, int endX, int width, int height, ColumnHit* columns) {
+    with_map_shape(scene->map, [&](auto shape) {
+        cast_stream_fixed<ScalarLanes, decltype(shape)>(scene, startX, endX, width, height, columns);
+    });
+}
+
+PacketKernel simd_raycast::kernel(SimdIsa isa, DdaPrecision precision) {
+
+    //never hand out a kernel the machine can't run
+    if (!simd::supported(isa)) {
+        isa = SimdIsa::SCALAR;
+    }
+
+    if (precision == DdaPrecision::FIXED) {
+        switch (isa) {
+        case SimdIsa::SSE41:
+            return { isa, 4, cast_packet_fixed_sse41, cast_stream_fixed_sse41 };
+        case SimdIsa::AVX2:
+            return { isa, 8, cast_packet_fixed_avx2, cast_stream_fixed_avx2 };
+        case SimdIsa::AVX512:
+            return { isa, 16, cast_packet_fixed_avx512, cast_stream_fixed_avx512 };
+        default:
+            return { SimdIsa::SCALAR, 1, cast_packet_fixed_scalar, cast_stream_fixed_scalar };
+        }
+    }
+
+    switch (isa) {
+    case SimdIsa::SSE41:
+        return { isa, 4, cast_packet_sse41, cast_stream_sse41 };
+    case SimdIsa::AVX2:
+        return { isa, 8, cast_packet_avx2, cast_stream_avx2 };
+    case SimdIsa::AVX512:
+        return { isa, 16, cast_packet_avx512, cast_stream_avx512 };
+    default:
+        return { SimdIsa::SCALAR, 1, cast_packet_scalar, cast_stream_scalar };
+    }
+}
\ No newline at end of file
@@ -0,0 +1,46 @@
+#pragma once
+#include "config.h"
+#include "scene.h"
+#include "raycast.h"
+#include "simd.h"
+
+//Casts width neighbouring columns, starting at x, into hits
+typedef void (*PacketCaster)(Scene* scene, int x, int width, int height, ColumnHit* hits);
+//Casts every column from startX up to endX into columns[x - startX]
+typedef void (*StreamCaster)(Scene* scene, int startX, int endX, int width, int height, ColumnHit* columns);
+
+struct PacketKernel {
+	SimdIsa isa;
+	int width;
+	PacketCaster cast;
+	StreamCaster stream;
+};
+
+namespace simd_raycast {
+
+	//widest packet any kernel casts
+	const int maxWidth = 16;
+
+	PacketKernel kernel(SimdIsa isa, DdaPrecision precision = DdaPrecision::FLOAT);
+
+	void cast_packet_scalar(Scene* scene, int x, int width, int height, ColumnHit* hits);
+	void cast_packet_sse41(Scene* scene, int x, int width, int height, ColumnHit* hits);
+	void cast_packet_avx2(Scene* scene, int x, int width, int height, ColumnHit* hits);
+	void cast_packet_avx512(Scene* scene, int x, int width, int height, ColumnHit* hits);
+
+	void cast_stream_scalar(Scene* scene, int startX, int endX, int width, int height, ColumnHit* columns);
+	void cast_stream_sse41(Scene* scene, int startX, int endX, int width, int height, ColumnHit* columns);
+	void cast_stream_avx2(Scene* scene, int startX, int endX, int width, int height, ColumnHit* columns);
+	void cast_stream_avx512(Scene* scene, int startX, int endX, int width, int height, ColumnHit* columns);
+
+	//the same, in fixed point
+	void cast_packet_fixed_scalar(Scene* scene, int x, int width, int height, ColumnHit* hits);
+	void cast_packet_fixed_sse41(Scene* scene, int x, int width, int height, ColumnHit* hits);
+	void cast_packet_fixed_avx2(Scene* scene, int x, int width, int height, ColumnHit* hits);
+	void cast_packet_fixed_avx512(Scene* scene, int x, int width, int height, ColumnHit* hits);
+
+	void cast_stream_fixed_scalar(Scene* scene, int startX, int endX, int width, int height, ColumnHit* columns);
+	void cast_stream_fixed_sse41(Scene* scene, int startX, int endX, int width, int height, ColumnHit* columns);
+	void cast_stream_fixed_avx2(Scene* scene, int startX, int endX, int width, int height, ColumnHit* columns);
+	void cast_stream_fixed_avx512(Scene* scene, int startX, int endX, int width, int height, ColumnHit* columns);
+}
\ No newline at end of file
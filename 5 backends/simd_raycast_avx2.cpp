@@ -0,0 +1,95 @@
+#include "simd_raycast.h"
+
+//everything from here on may use AVX2 and FMA, and is only called once
+//the cpu is known to have them
+#if defined(__clang__)
+#pragma clang attribute push (__attribute__((target("avx2,fma"))), apply_to = function)
+#elif defined(__GNUC__)
+#pragma GCC push_options
+#pragma GCC target("avx2,fma")
+#endif
+
+#include "simd_raycast_kernel.h"
+#include "simd_raycast_fixed.h"
+
+struct Avx2Lanes {
+    static const int width = 8;
+    typedef __m256 Float;
+    typedef __m256i Int;
+    typedef __m256 Mask;
+
+    static Float set(float value) { return _mm256_set1_ps(value); }
+    static Float iota() { return _mm256_setr_ps(0, 1, 2, 3, 4, 5, 6, 7); }
+    static Float load(const float* in) { return _mm256_load_ps(in); }
+    static void store(float* out, Float a) { _mm256_store_ps(out, a); }
+    static Int load_int(const int* in) { return _mm256_load_si256((const __m256i*)in); }
+    static void store_int(int* out, Int a) { _mm256_store_si256((__m256i*)out, a); }
+
+    static Float add(Float a, Float b) { return _mm256_add_ps(a, b); }
+    static Float sub(Float a, Float b) { return _mm256_sub_ps(a, b); }
+    static Float mul(Float a, Float b) { return _mm256_mul_ps(a, b); }
+    static Float div(Float a, Float b) { return _mm256_div_ps(a, b); }
+    static Float fmadd(Float a, Float b, Float c) { return _mm256_fmadd_ps(a, b, c); }
+    static Float abs(Float a) { return _mm256_andnot_ps(_mm256_set1_ps(-0.0f), a); }
+    static Float min(Float a, Float b) { return _mm256_min_ps(a, b); }
+    static Float max(Float a, Float b) { return _mm256_max_ps(a, b); }
+
+    static Mask less(Float a, Float b) { return _mm256_cmp_ps(a, b, _CMP_LT_OQ); }
+    static Mask equal(Float a, Float b) { return _mm256_cmp_ps(a, b, _CMP_EQ_UQ); }
+    static bool all(Mask mask) { return _mm256_movemask_ps(mask) == 0xff; }
+    static Mask either(Mask a, Mask b) { return _mm256_or_ps(a, b); }
+    static int bits(Mask mask) { return _mm256_movemask_ps(mask); }
+    static Mask from_bits(int bits) {
+        __m256i laneBits = _mm256_setr_epi32(1, 2, 4, 8, 16, 32, 64, 128);
+        return _mm256_castsi256_ps(_mm256_cmpeq_epi32(_mm256_and_si256(_mm256_set1_epi32(bits), laneBits), laneBits));
+    }
+    static Float select(Mask mask, Float a, Float b) { return _mm256_blendv_ps(b, a, mask); }
+    static Float floor(Float a) { return _mm256_floor_ps(a); }
+    static Int truncate(Float a) { return _mm256_cvttps_epi32(a); }
+    static Float convert(Int a) { return _mm256_cvtepi32_ps(a); }
+
+    static Int gather(const int* base, Int index) { return _mm256_i32gather_epi32(base, index, 4); }
+    static Int gather_byte(const uint8_t* base, Int index) {
+        return _mm256_and_si256(_mm256_i32gather_epi32(reinterpret_cast<const int*>(base), index, 1), _mm256_set1_epi32(0xff));
+    }
+    static Mask is_zero(Int a) { return _mm256_castsi256_ps(_mm256_cmpeq_epi32(a, _mm256_setzero_si256())); }
+    static Mask less_int(Int a, Int b) { return _mm256_castsi256_ps(_mm256_cmpgt_epi32(b, a)); }
+    static Int set_int(int value) { return _mm256_set1_epi32(value); }
+    static Int add_int(Int a, Int b) { return _mm256_add_epi32(a, b); }
+    static Int mul_int(Int a, Int b) { return _mm256_mullo_epi32(a, b); }
+    static Int and_int(Int a, Int b) { return _mm256_and_si256(a, b); }
+    static Int or_int(Int a, Int b) { return _mm256_or_si256(a, b); }
+    static Int shift_left(Int a, int count) { return _mm256_slli_epi32(a, count); }
+    static Int shift_right(Int a, int count) { return _mm256_srai_epi32(a, count); }
+    static Int select_int(Mask mask, Int a, Int b) { return _mm256_blendv_epi8(b, a, _mm256_castps_si256(mask)); }
+};
+
+void simd_raycast::cast_packet_avx2(Scene* scene, int x, int width, int height, ColumnHit* hits) {
+    with_map_shape(scene->map, [&](auto shape) {
+        cast_packet<Avx2Lanes, decltype(shape)>(scene, x, width, height, hits);
+    });
+}
+
+void simd_raycast::cast_stream_avx2(Scene* scene, int startX, int endX, int width, int height, ColumnHit* columns) {
+    with_map_shape(scene->map, [&](auto shape) {
+        cast_stream<Avx2Lanes, decltype(shape)>(scene, startX, endX, width, height, columns);
+    });
+}
+
+void simd_raycast::cast_packet_fixed_avx2(Scene* scene, int x, int width, int height, ColumnHit* hits) {
+    with_map_shape(scene->map, [&](auto shape) {
+        cast_packet_fixed<Avx2Lanes, decltype(shape)>(scene, x, width, height, hits);
+    });
+}
+
+void simd_raycast::cast_stream_fixed_avx2(Scene* scene, int startX, int endX, int width, int height, ColumnHit* columns) {
+    with_map_shape(scene->map, [&](auto shape) {
+        cast_stream_fixed<Avx2Lanes, decltype(shape)>(scene, startX, endX, width, height, columns);
+    });
+}
+
+#if defined(__clang__)
+#pragma clang attribute pop
+#elif defined(__GNUC__)
+#pragma GCC pop_options
+#endif
\ No newline at end of file
@@ -0,0 +1,92 @@
+#include "simd_raycast.h"
+
+//everything from here on may use AVX-512F, and is only called once
+//the cpu is known to have it
+#if defined(__clang__)
+#pragma clang attribute push (__attribute__((target("avx512f"))), apply_to = function)
+#elif defined(__GNUC__)
+#pragma GCC push_options
+#pragma GCC target("avx512f")
+#endif
+
+#include "simd_raycast_kernel.h"
+#include "simd_raycast_fixed.h"
+
+struct Avx512Lanes {
+    static const int width = 16;
+    typedef __m512 Float;
+    typedef __m512i Int;
+    typedef __mmask16 Mask;
+
+    static Float set(float value) { return _mm512_set1_ps(value); }
+    static Float iota() { return _mm512_setr_ps(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15); }
+    static Float load(const float* in) { return _mm512_load_ps(in); }
+    static void store(float* out, Float a) { _mm512_store_ps(out, a); }
+    static Int load_int(const int* in) { return _mm512_load_si512(in); }
+    static void store_int(int* out, Int a) { _mm512_store_si512(out, a); }
+
+    static Float add(Float a, Float b) { return _mm512_add_ps(a, b); }
+    static Float sub(Float a, Float b) { return _mm512_sub_ps(a, b); }
+    static Float mul(Float a, Float b) { return _mm512_mul_ps(a, b); }
+    static Float div(Float a, Float b) { return _mm512_div_ps(a, b); }
+    static Float fmadd(Float a, Float b, Float c) { return _mm512_fmadd_ps(a, b, c); }
+    static Float abs(Float a) { return _mm512_abs_ps(a); }
+    static Float min(Float a, Float b) { return _mm512_min_ps(a, b); }
+    static Float max(Float a, Float b) { return _mm512_max_ps(a, b); }
+
+    static Mask less(Float a, Float b) { return _mm512_cmp_ps_mask(a, b, _CMP_LT_OQ); }
+    static Mask equal(Float a, Float b) { return _mm512_cmp_ps_mask(a, b, _CMP_EQ_UQ); }
+    static bool all(Mask mask) { return mask == 0xffff; }
+    static Mask either(Mask a, Mask b) { return static_cast<Mask>(a | b); }
+    static int bits(Mask mask) { return mask; }
+    static Mask from_bits(int bits) { return static_cast<Mask>(bits); }
+    static Float select(Mask mask, Float a, Float b) { return _mm512_mask_blend_ps(mask, b, a); }
+    static Float floor(Float a) { return _mm512_roundscale_ps(a, _MM_FROUND_TO_NEG_INF | _MM_FROUND_NO_EXC); }
+    static Int truncate(Float a) { return _mm512_cvttps_epi32(a); }
+    static Float convert(Int a) { return _mm512_cvtepi32_ps(a); }
+
+    static Int gather(const int* base, Int index) { return _mm512_i32gather_epi32(index, base, 4); }
+    static Int gather_byte(const uint8_t* base, Int index) {
+        return _mm512_and_si512(_mm512_i32gather_epi32(index, base, 1), _mm512_set1_epi32(0xff));
+    }
+    static Mask is_zero(Int a) { return _mm512_cmpeq_epi32_mask(a, _mm512_setzero_si512()); }
+    static Mask less_int(Int a, Int b) { return _mm512_cmplt_epi32_mask(a, b); }
+    static Int set_int(int value) { return _mm512_set1_epi32(value); }
+    static Int add_int(Int a, Int b) { return _mm512_add_epi32(a, b); }
+    static Int mul_int(Int a, Int b) { return _mm512_mullo_epi32(a, b); }
+    static Int and_int(Int a, Int b) { return _mm512_and_si512(a, b); }
+    static Int or_int(Int a, Int b) { return _mm512_or_si512(a, b); }
+    static Int shift_left(Int a, int count) { return _mm512_slli_epi32(a, count); }
+    static Int shift_right(Int a, int count) { return _mm512_srai_epi32(a, count); }
+    static Int select_int(Mask mask, Int a, Int b) { return _mm512_mask_blend_epi32(mask, b, a); }
+};
+
+void simd_raycast::cast_packet_avx512(Scene* scene, int x, int width, int height, ColumnHit* hits) {
+    with_map_shape(scene->map, [&](auto shape) {
+        cast_packet<Avx512Lanes, decltype(shape)>(scene, x, width, height, hits);
+    });
+}
+
+void simd_raycast::cast_stream_avx512(Scene* scene, int startX, int endX, int width, int height, ColumnHit* columns) {
+    with_map_shape(scene->map, [&](auto shape) {
+        cast_stream<Avx512Lanes, decltype(shape)>(scene, startX, endX, width, height, columns);
+    });
+}
+
+void simd_raycast::cast_packet_fixed_avx512(Scene* scene, int x, int width, int height, ColumnHit* hits) {
+    with_map_shape(scene->map, [&](auto shape) {
+        cast_packet_fixed<Avx512Lanes, decltype(shape)>(scene, x, width, height, hits);
+    });
+}
+
+void simd_raycast::cast_stream_fixed_avx512(Scene* scene, int startX, int endX, int width, int height, ColumnHit* columns) {
+    with_map_shape(scene->map, [&](auto shape) {
+        cast_stream_fixed<Avx512Lanes, decltype(shape)>(scene, startX, endX, width, height, columns);
+    });
+}
+
+#if defined(__clang__)
+#pragma clang attribute pop
+#elif defined(__GNUC__)
+#pragma GCC pop_options
+#endif
\ No newline at end of file
@@ -0,0 +1,213 @@
+#pragma once
+#include "simd_raycast_kernel.h"
+
+/*
+	The fixed point packet DDA. Every step is integer lanes; setting a
+	ray up, jumping it and turning its hit into a span happen once a ray
+	at most, so those go one lane at a time through FixedRay and come
+	out exactly as raycast::cast_column_fixed has them.
+
+	Uses the same Lanes and map shapes as the float kernel.
+*/
+template <typename Lanes, typename Shape>
+struct FixedPacketRays {
+    typedef typename Lanes::Int Int;
+    typedef typename Lanes::Mask Mask;
+
+    Int mapX, mapY;
+    Int stepX, stepY;
+    Int deltaDistX, deltaDistY;
+    Int sideDistX, sideDistY;
+    Int side;
+    Int steps;
+
+    //one ray per lane from rays
+    void load(const FixedRay* rays) {
+        alignas(64) int fields[10][Lanes::width];
+        for (int lane = 0; lane < Lanes::width; ++lane) {
+            const FixedRay& ray = rays[lane];
+            fields[0][lane] = ray.mapX;
+            fields[1][lane] = ray.mapY;
+            fields[2][lane] = ray.stepX;
+            fields[3][lane] = ray.stepY;
+            fields[4][lane] = ray.deltaDistX;
+            fields[5][lane] = ray.deltaDistY;
+            fields[6][lane] = ray.sideDistX;
+            fields[7][lane] = ray.sideDistY;
+            fields[8][lane] = ray.side;
+            fields[9][lane] = ray.steps;
+        }
+        mapX = Lanes::load_int(fields[0]);
+        mapY = Lanes::load_int(fields[1]);
+        stepX = Lanes::load_int(fields[2]);
+        stepY = Lanes::load_int(fields[3]);
+        deltaDistX = Lanes::load_int(fields[4]);
+        deltaDistY = Lanes::load_int(fields[5]);
+        sideDistX = Lanes::load_int(fields[6]);
+        sideDistY = Lanes::load_int(fields[7]);
+        side = Lanes::load_int(fields[8]);
+        steps = Lanes::load_int(fields[9]);
+    }
+
+    //and back out again
+    void store(FixedRay* rays) const {
+        alignas(64) int fields[10][Lanes::width];
+        Lanes::store_int(fields[0], mapX);
+        Lanes::store_int(fields[1], mapY);
+        Lanes::store_int(fields[2], stepX);
+        Lanes::store_int(fields[3], stepY);
+        Lanes::store_int(fields[4], deltaDistX);
+        Lanes::store_int(fields[5], deltaDistY);
+        Lanes::store_int(fields[6], sideDistX);
+        Lanes::store_int(fields[7], sideDistY);
+        Lanes::store_int(fields[8], side);
+        Lanes::store_int(fields[9], steps);
+        for (int lane = 0; lane < Lanes::width; ++lane) {
+            FixedRay& ray = rays[lane];
+            ray.mapX = fields[0][lane];
+            ray.mapY = fields[1][lane];
+            ray.stepX = fields[2][lane];
+            ray.stepY = fields[3][lane];
+            ray.deltaDistX = fields[4][lane];
+            ray.deltaDistY = fields[5][lane];
+            ray.sideDistX = fields[6][lane];
+            ray.sideDistY = fields[7][lane];
+            ray.side = fields[8][lane];
+            ray.steps = fields[9][lane];
+        }
+    }
+
+    //FixedRay::step for every lane outside frozen, then the hit test.
+    //Lanes with room around them jump on across it.
+    //Returns the lanes standing where they stop, or out of sight.
+    Mask advance(Scene* scene, const FixedCamera& camera, Mask frozen) {
+
+        const Int zero = Lanes::set_int(0);
+        const Int one = Lanes::set_int(1);
+
+        //jump to next map square, either in x-direction, or in y-direction
+        Mask sideMask = Lanes::less_int(sideDistX, sideDistY);
+        sideDistX = Lanes::select_int(frozen, sideDistX, Lanes::select_int(sideMask, Lanes::add_int(sideDistX, deltaDistX), sideDistX));
+        mapX = Lanes::select_int(frozen, mapX, Lanes::select_int(sideMask, Lanes::add_int(mapX, stepX), mapX));
+        sideDistY = Lanes::select_int(frozen, sideDistY, Lanes::select_int(sideMask, sideDistY, Lanes::add_int(sideDistY, deltaDistY)));
+        mapY = Lanes::select_int(frozen, mapY, Lanes::select_int(sideMask, mapY, Lanes::add_int(mapY, stepY)));
+        side = Lanes::select_int(frozen, side, Lanes::select_int(sideMask, zero, one));
+        steps = Lanes::select_int(frozen, steps, Lanes::add_int(steps, one));
+
+        //Check if ray has hit a wall, walls have no clearance, or is about
+        //to go out of sight. Frozen lanes read the same cell again, so
+        //they stay hit.
+        const MapGrid& map = scene->map;
+        Int clearance = Lanes::gather_byte(map.clearance.data(), cell_indices<Lanes, Shape>(map, mapX, mapY));
+        Int nextCrossing = Lanes::select_int(Lanes::less_int(sideDistX, sideDistY), sideDistX, sideDistY);
+        Mask far = Lanes::less_int(Lanes::set_int(camera.maxDistance), nextCrossing);
+        int openLanes = Lanes::bits(Lanes::less_int(Lanes::set_int(MapGrid::jumpClearance), clearance))
+            & ~Lanes::bits(Lanes::either(frozen, far));
+        if (openLanes) {
+            jump_open(scene, openLanes);
+        }
+        return Lanes::either(Lanes::is_zero(clearance), far);
+    }
+
+    //jumps are rare, so each open lane takes its own
+    void jump_open(Scene* scene, int openLanes) {
+
+        FixedRay rays[Lanes::width];
+        store(rays);
+        for (int lane = 0; lane < Lanes::width; ++lane) {
+            if (!(openLanes & (1 << lane))) {
+                continue;
+            }
+            FixedRay& ray = rays[lane];
+            int reachX, reachY;
+            scene->map.open_reach(ray.mapX, ray.mapY, ray.stepX, ray.stepY, reachX, reachY);
+            ray.jump(reachX, reachY);
+        }
+        load(rays);
+    }
+};
+
+//All lanes start together and the packet finishes with its longest ray
+template <typename Lanes, typename Shape>
+void cast_packet_fixed(Scene* scene, int x, int width, int height, ColumnHit* hits) {
+
+    const int laneCount = Lanes::width;
+    const FixedCamera camera(scene);
+
+    FixedRay lanes[laneCount];
+    for (int lane = 0; lane < laneCount; ++lane) {
+        lanes[lane].aim(camera, x + lane, width);
+    }
+    FixedPacketRays<Lanes, Shape> rays;
+    rays.load(lanes);
+
+    //perform DDA, lanes which have hit stay where they are
+    typename Lanes::Mask hitMask = Lanes::from_bits(0);
+    do {
+        hitMask = rays.advance(scene, camera, hitMask);
+    } while (!Lanes::all(hitMask));
+
+    rays.store(lanes);
+    for (int lane = 0; lane < laneCount; ++lane) {
+        hits[lane] = lanes[lane].resolve(scene->map, camera, height);
+    }
+}
+
+//Lanes pick up the next column as soon as their ray hits, as in
+//cast_stream
+template <typename Lanes, typename Shape>
+void cast_stream_fixed(Scene* scene, int startX, int endX, int width, int height, ColumnHit* columns) {
+
+    const int laneCount = Lanes::width;
+    const int allLanes = (1 << laneCount) - 1;
+    if (startX >= endX) {
+        return;
+    }
+    const FixedCamera camera(scene);
+
+    //which column each lane works on, and the lanes with nothing left.
+    //Idle lanes trace a copy of the first column, and stay frozen on its wall
+    FixedRay lanes[laneCount];
+    int laneColumn[laneCount];
+    int idleLanes = 0;
+    int nextX = startX;
+    for (int lane = 0; lane < laneCount; ++lane) {
+        if (nextX < endX) {
+            laneColumn[lane] = nextX++;
+        }
+        else {
+            laneColumn[lane] = startX;
+            idleLanes |= 1 << lane;
+        }
+        lanes[lane].aim(camera, laneColumn[lane], width);
+    }
+    FixedPacketRays<Lanes, Shape> rays;
+    rays.load(lanes);
+
+    while (idleLanes != allLanes) {
+
+        int hitLanes = Lanes::bits(rays.advance(scene, camera, Lanes::from_bits(idleLanes))) & ~idleLanes;
+        if (!hitLanes) {
+            continue;
+        }
+
+        //hand the finished columns over, and give those lanes new ones
+        rays.store(lanes);
+        for (int lane = 0; lane < laneCount; ++lane) {
+            if (!(hitLanes & (1 << lane))) {
+                continue;
+            }
+
+            columns[laneColumn[lane] - startX] = lanes[lane].resolve(scene->map, camera, height);
+
+            if (nextX < endX) {
+                laneColumn[lane] = nextX++;
+                lanes[lane].aim(camera, laneColumn[lane], width);
+            }
+            else {
+                idleLanes |= 1 << lane;
+            }
+        }
+        rays.load(lanes);
+    }
+}
\ No newline at end of file
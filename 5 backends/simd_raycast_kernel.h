@@ -0,0 +1,362 @@
+#pragma once
+#include "simd_raycast.h"
+
+/*
+	The packet DDA, written once for any lane width. Lanes supplies the
+	vector types and operations:
+
+	width                         lanes per packet
+	Float, Int, Mask              vector of floats, of ints, and a
+	                              comparison result
+	set, iota, load, store        broadcast, 0 1 2 ..., aligned load and
+	                              store
+	add, sub, mul, div, fmadd     arithmetic, fmadd(a, b, c) = a * b + c
+	abs, min, max
+	less, equal                   lane-wise comparisons
+	all(mask)                     true once every lane is set
+	either(a, b)                  lanes set in either mask
+	bits, from_bits               mask to and from one bit per lane
+	select(mask, a, b)            a where mask is set, b elsewhere
+	floor                         round down
+	truncate, convert             float to int conversion and back
+	load_int, store_int           aligned load and store, for ints
+	gather(base, index)           base[index] for every lane
+	gather_byte(base, index)      the same, for bytes. May read the
+	                              three bytes after each one
+	is_zero(a)                    mask of int lanes equal to zero
+	less_int                      less, for ints
+	set_int, add_int, mul_int,    broadcast and arithmetic, for ints.
+	and_int, or_int, shift_left,  mul_int keeps the low 32 bits, shifts
+	shift_right                   are by a constant and shift_right
+	                              keeps the sign
+	select_int(mask, a, b)        select, for ints
+
+	Each instruction set includes this in its own translation unit, built
+	for that instruction set, so this must stay header-only.
+*/
+
+//Shape::cell_index for cell (x, y) in every lane. Shifts are by
+//constants, so a map whose shape isn't known yet multiplies instead.
+template <typename Lanes, typename Shape>
+typename Lanes::Int cell_indices(const MapGrid& map, typename Lanes::Int x, typename Lanes::Int y) {
+    typedef typename Lanes::Int Int;
+    const Int tileMask = Lanes::set_int(MapGrid::tileMask);
+    Int tileColumn = Lanes::shift_right(x, MapGrid::tileShift);
+    if constexpr (Shape::isStatic) {
+        tileColumn = Lanes::shift_left(tileColumn, Shape::tileRowShift);
+    }
+    else {
+        tileColumn = Lanes::mul_int(tileColumn, Lanes::set_int(map.heightInTiles));
+    }
+    Int tile = Lanes::add_int(tileColumn, Lanes::shift_right(y, MapGrid::tileShift));
+    Int inTile = Lanes::add_int(
+        Lanes::shift_left(Lanes::and_int(x, tileMask), MapGrid::tileShift), Lanes::and_int(y, tileMask));
+    return Lanes::add_int(Lanes::shift_left(tile, 2 * MapGrid::tileShift), inTile);
+}
+
+//raycast::fade for every lane
+template <typename Lanes>
+typename Lanes::Int fade_colors(typename Lanes::Int colors, typename Lanes::Int factor) {
+    typedef typename Lanes::Int Int;
+    const Int channels = Lanes::set_int(0x00ff00ff);
+    Int evenChannels = Lanes::and_int(Lanes::shift_right(Lanes::mul_int(Lanes::and_int(colors, channels), factor), 8), channels);
+    Int oddChannels = Lanes::and_int(Lanes::mul_int(Lanes::and_int(Lanes::shift_right(colors, 8), channels), factor),
+        Lanes::set_int(static_cast<int>(0xff00ff00u)));
+    return Lanes::or_int(evenChannels, oddChannels);
+}
+
+//One ray per lane, each walking the map on its own, finding cells as
+//Shape does
+template <typename Lanes, typename Shape>
+struct PacketRays {
+    typedef typename Lanes::Float Float;
+    typedef typename Lanes::Int Int;
+    typedef typename Lanes::Mask Mask;
+
+    Float rayPosX, rayPosY;
+    Float stepX, stepY;
+    Float deltaDistX, deltaDistY;
+    Float sideDistX, sideDistY;
+    Float side;
+    Float steps;
+
+    //start a ray from the player through each lane's screen column
+    void aim(Scene* scene, Float screenXCoords, int width) {
+
+        const glm::vec3 position = scene->player->position;
+        const glm::vec3 forwards = scene->player->forwards;
+        const glm::vec3 right = scene->player->right;
+        const Float zero = Lanes::set(0.0f);
+        const Float one = Lanes::set(1.0f);
+
+        //Orient the ray
+        Float horizontalCoefficients = Lanes::fmadd(Lanes::set(2.0f / width), screenXCoords, Lanes::set(-1.0f));
+        Float rayXDirections = Lanes::fmadd(Lanes::set(right.x), horizontalCoefficients, Lanes::set(forwards.x));
+        Float rayYDirections = Lanes::fmadd(Lanes::set(right.y), horizontalCoefficients, Lanes::set(forwards.y));
+        rayPosX = Lanes::set(static_cast<float>(int(position.x)));
+        rayPosY = Lanes::set(static_cast<float>(int(position.y)));
+
+        //DDA Parameters
+        Mask zeroMask = Lanes::equal(rayXDirections, zero);
+        Mask negativeMask = Lanes::less(rayXDirections, zero);
+        deltaDistX = Lanes::select(zeroMask, Lanes::set(1e30f), Lanes::div(one, Lanes::abs(rayXDirections)));
+        stepX = Lanes::select(negativeMask, Lanes::set(-1.0f), one);
+        sideDistX = Lanes::mul(deltaDistX, Lanes::select(negativeMask,
+            Lanes::set(static_cast<float>(position.x - int(position.x))),
+            Lanes::set(static_cast<float>(int(position.x) + 1.0 - position.x))));
+
+        zeroMask = Lanes::equal(rayYDirections, zero);
+        negativeMask = Lanes::less(rayYDirections, zero);
+        deltaDistY = Lanes::select(zeroMask, Lanes::set(1e30f), Lanes::div(one, Lanes::abs(rayYDirections)));
+        stepY = Lanes::select(negativeMask, Lanes::set(-1.0f), one);
+        sideDistY = Lanes::mul(deltaDistY, Lanes::select(negativeMask,
+            Lanes::set(static_cast<float>(position.y - int(position.y))),
+            Lanes::set(static_cast<float>(int(position.y) + 1.0 - position.y))));
+
+        side = zero;
+        steps = zero;
+    }
+
+    //take over the lanes in mask from other
+    void replace(Mask mask, const PacketRays& other) {
+        rayPosX = Lanes::select(mask, other.rayPosX, rayPosX);
+        rayPosY = Lanes::select(mask, other.rayPosY, rayPosY);
+        stepX = Lanes::select(mask, other.stepX, stepX);
+        stepY = Lanes::select(mask, other.stepY, stepY);
+        deltaDistX = Lanes::select(mask, other.deltaDistX, deltaDistX);
+        deltaDistY = Lanes::select(mask, other.deltaDistY, deltaDistY);
+        sideDistX = Lanes::select(mask, other.sideDistX, sideDistX);
+        sideDistY = Lanes::select(mask, other.sideDistY, sideDistY);
+        side = Lanes::select(mask, other.side, side);
+        steps = Lanes::select(mask, other.steps, steps);
+    }
+
+    //the clearance of every lane's cell, zero in walls
+    Int probe(Scene* scene) const {
+        const MapGrid& map = scene->map;
+        return Lanes::gather_byte(map.clearance.data(),
+            cell_indices<Lanes, Shape>(map, Lanes::truncate(rayPosX), Lanes::truncate(rayPosY)));
+    }
+
+    //take every crossing before each lane leaves the empty space around
+    //it, reachX crossings along x and reachY along y. Ties go to y, as
+    //in the steps, and lanes with no reach stay put.
+    void jump(Float reachX, Float reachY) {
+        const Float zero = Lanes::set(0.0f);
+        const Float one = Lanes::set(1.0f);
+
+        Float exitDist = Lanes::min(Lanes::fmadd(reachX, deltaDistX, sideDistX), Lanes::fmadd(reachY, deltaDistY, sideDistY));
+        Float crossingsX = Lanes::sub(zero, Lanes::floor(Lanes::div(Lanes::sub(sideDistX, exitDist), deltaDistX)));
+        crossingsX = Lanes::min(reachX, Lanes::max(zero, crossingsX));
+        Float crossingsY = Lanes::add(Lanes::floor(Lanes::div(Lanes::sub(exitDist, sideDistY), deltaDistY)), one);
+        crossingsY = Lanes::min(reachY, Lanes::max(zero, crossingsY));
+
+        sideDistX = Lanes::fmadd(crossingsX, deltaDistX, sideDistX);
+        sideDistY = Lanes::fmadd(crossingsY, deltaDistY, sideDistY);
+        rayPosX = Lanes::fmadd(crossingsX, stepX, rayPosX);
+        rayPosY = Lanes::fmadd(crossingsY, stepY, rayPosY);
+        steps = Lanes::add(steps, Lanes::add(crossingsX, crossingsY));
+    }
+
+    //one DDA step for every lane outside frozen, then the hit test.
+    //Lanes with room around them jump on across it.
+    //Returns the lanes standing where they stop, or out of sight.
+    Mask advance(Scene* scene, Mask frozen) {
+
+        const Float zero = Lanes::set(0.0f);
+        const Float one = Lanes::set(1.0f);
+
+        //jump to next map square, either in x-direction, or in y-direction
+        Mask sideMask = Lanes::less(sideDistX, sideDistY);
+        sideDistX = Lanes::select(frozen, sideDistX, Lanes::select(sideMask, Lanes::add(sideDistX, deltaDistX), sideDistX));
+        rayPosX = Lanes::select(frozen, rayPosX, Lanes::select(sideMask, Lanes::add(rayPosX, stepX), rayPosX));
+        sideDistY = Lanes::select(frozen, sideDistY, Lanes::select(sideMask, sideDistY, Lanes::add(sideDistY, deltaDistY)));
+        rayPosY = Lanes::select(frozen, rayPosY, Lanes::select(sideMask, rayPosY, Lanes::add(rayPosY, stepY)));
+        side = Lanes::select(frozen, side, Lanes::select(sideMask, zero, one));
+        steps = Lanes::select(frozen, steps, Lanes::add(steps, one));
+
+        //Check if ray has hit a wall, walls have no clearance, or is about
+        //to go out of sight. Frozen lanes read the same cell again, so
+        //they stay hit.
+        Int clearance = probe(scene);
+        Mask far = Lanes::less(Lanes::set(scene->maxDistance), Lanes::min(sideDistX, sideDistY));
+        Float reach = Lanes::select(Lanes::either(frozen, far), zero, Lanes::sub(Lanes::convert(clearance), one));
+        int openLanes = Lanes::bits(Lanes::less(Lanes::set(static_cast<float>(MapGrid::jumpClearance - 1)), reach));
+        if (openLanes) {
+            jump_open(scene, openLanes);
+        }
+        return Lanes::either(Lanes::is_zero(clearance), far);
+    }
+
+    //jumps are rare, so each open lane looks its empty space up on its own
+    void jump_open(Scene* scene, int openLanes) {
+
+        alignas(64) float laneX[Lanes::width], laneY[Lanes::width], laneStepX[Lanes::width], laneStepY[Lanes::width];
+        alignas(64) float laneReachX[Lanes::width], laneReachY[Lanes::width];
+        Lanes::store(laneX, rayPosX);
+        Lanes::store(laneY, rayPosY);
+        Lanes::store(laneStepX, stepX);
+        Lanes::store(laneStepY, stepY);
+
+        for (int lane = 0; lane < Lanes::width; ++lane) {
+            int reachX = 0, reachY = 0;
+            if (openLanes & (1 << lane)) {
+                scene->map.open_reach(static_cast<int>(laneX[lane]), static_cast<int>(laneY[lane]),
+                    static_cast<int>(laneStepX[lane]), static_cast<int>(laneStepY[lane]), reachX, reachY);
+            }
+            laneReachX[lane] = static_cast<float>(reachX);
+            laneReachY[lane] = static_cast<float>(reachY);
+        }
+        jump(Lanes::load(laneReachX), Lanes::load(laneReachY));
+    }
+
+    //wall spans for every lane, as if each had just hit
+    void resolve(Scene* scene, int height, int* drawStart, int* drawEnd, int* color, int* paletteIndex, int* stepCount) {
+
+        const Float zero = Lanes::set(0.0f);
+        const Float maxDistance = Lanes::set(scene->maxDistance);
+
+        //Record depth
+        Mask sideYMask = Lanes::less(zero, side);
+        Float perpWallDist = Lanes::select(sideYMask,
+            Lanes::sub(sideDistY, deltaDistY), Lanes::sub(sideDistX, deltaDistX));
+
+        //Record color, giving x and y sides different brightness. This is
+        //the only time the material plane is read.
+        const MapGrid& map = scene->map;
+        Int materialIndex = Lanes::gather_byte(map.materials.data(),
+            cell_indices<Lanes, Shape>(map, Lanes::truncate(rayPosX), Lanes::truncate(rayPosY)));
+        Int colors = Lanes::gather(reinterpret_cast<const int*>(raycast::colors), materialIndex);
+        colors = Lanes::select_int(sideYMask, Lanes::shift_right(colors, 1), colors);
+
+        //fade into the fog, and sky where there's no wall in sight, as
+        //raycast::cast_column has it
+        Float fog = Lanes::min(Lanes::set(256.0f), Lanes::max(zero,
+            Lanes::mul(Lanes::sub(maxDistance, perpWallDist), Lanes::set(raycast::fog_scale(scene)))));
+        Int fogFactor = Lanes::truncate(fog);
+        colors = fade_colors<Lanes>(colors, fogFactor);
+        Mask skyMask = Lanes::either(Lanes::is_zero(materialIndex), Lanes::less(maxDistance, perpWallDist));
+        const Int zeroInt = Lanes::set_int(0);
+
+        //Calculate height of line to draw on screen
+        const Float screenHeight = Lanes::set(static_cast<float>(height));
+        Float lineHeight = Lanes::div(screenHeight, perpWallDist);
+
+        //calculate lowest and highest pixel to fill in current stripe
+        Float lowest = Lanes::max(zero, Lanes::mul(Lanes::set(0.5f), Lanes::sub(screenHeight, lineHeight)));
+        Float highest = Lanes::min(Lanes::set(static_cast<float>(height - 1)),
+            Lanes::mul(Lanes::set(0.5f), Lanes::add(screenHeight, lineHeight)));
+
+        Lanes::store_int(drawStart, Lanes::select_int(skyMask, Lanes::set_int(height / 2), Lanes::truncate(lowest)));
+        Lanes::store_int(drawEnd, Lanes::select_int(skyMask, Lanes::set_int(height / 2 - 1), Lanes::truncate(highest)));
+        Lanes::store_int(color, Lanes::select_int(skyMask, zeroInt, colors));
+        Lanes::store_int(stepCount, Lanes::truncate(steps));
+
+        //raycast::palette_index, with the first material's offset folded
+        //into the last add
+        Int fogLevel = Lanes::shift_right(Lanes::add_int(Lanes::mul_int(fogFactor, Lanes::set_int(raycast::fogLevels - 1)),
+            Lanes::set_int(128)), 8);
+        Int shade = Lanes::add_int(Lanes::add_int(materialIndex, materialIndex),
+            Lanes::select_int(sideYMask, Lanes::set_int(1), zeroInt));
+        Int entry = Lanes::add_int(Lanes::add_int(Lanes::mul_int(shade, Lanes::set_int(raycast::fogLevels)), fogLevel),
+            Lanes::set_int(1 - 2 * raycast::fogLevels));
+        Lanes::store_int(paletteIndex, Lanes::select_int(skyMask, zeroInt, entry));
+    }
+};
+
+//All lanes start together and the packet finishes with its longest ray
+template <typename Lanes, typename Shape>
+void cast_packet(Scene* scene, int x, int width, int height, ColumnHit* hits) {
+
+    const int laneCount = Lanes::width;
+
+    PacketRays<Lanes, Shape> rays;
+    rays.aim(scene, Lanes::add(Lanes::set(static_cast<float>(x)), Lanes::iota()), width);
+
+    //perform DDA, lanes which have hit stay where they are
+    typename Lanes::Mask hitMask = Lanes::less(Lanes::set(0.0f), Lanes::set(0.0f));
+    do {
+        hitMask = rays.advance(scene, hitMask);
+    } while (!Lanes::all(hitMask));
+
+    //the only time single lanes are read
+    alignas(64) int laneDrawStart[laneCount], laneDrawEnd[laneCount], laneColor[laneCount], laneIndex[laneCount], laneSteps[laneCount];
+    rays.resolve(scene, height, laneDrawStart, laneDrawEnd, laneColor, laneIndex, laneSteps);
+
+    for (int lane = 0; lane < laneCount; ++lane) {
+        hits[lane].drawStart = laneDrawStart[lane];
+        hits[lane].drawEnd = laneDrawEnd[lane];
+        hits[lane].color = laneColor[lane];
+        hits[lane].paletteIndex = laneIndex[lane];
+        hits[lane].steps = laneSteps[lane];
+    }
+}
+
+//Lanes pick up the next column as soon as their ray hits, so the packet
+//only runs part full while the last rays drain
+template <typename Lanes, typename Shape>
+void cast_stream(Scene* scene, int startX, int endX, int width, int height, ColumnHit* columns) {
+
+    const int laneCount = Lanes::width;
+    const int allLanes = (1 << laneCount) - 1;
+    if (startX >= endX) {
+        return;
+    }
+
+    //which column each lane works on, and the lanes with nothing left
+    alignas(64) float laneColumn[laneCount];
+    int idleLanes = 0;
+    int nextX = startX;
+    for (int lane = 0; lane < laneCount; ++lane) {
+        if (nextX < endX) {
+            laneColumn[lane] = static_cast<float>(nextX++);
+        }
+        else {
+            laneColumn[lane] = static_cast<float>(startX);
+            idleLanes |= 1 << lane;
+        }
+    }
+
+    //idle lanes trace a copy of the first column, and stay frozen on its wall
+    PacketRays<Lanes, Shape> rays;
+    rays.aim(scene, Lanes::load(laneColumn), width);
+    alignas(64) int laneDrawStart[laneCount], laneDrawEnd[laneCount], laneColor[laneCount], laneIndex[laneCount], laneSteps[laneCount];
+
+    while (idleLanes != allLanes) {
+
+        int hitLanes = Lanes::bits(rays.advance(scene, Lanes::from_bits(idleLanes))) & ~idleLanes;
+        if (!hitLanes) {
+            continue;
+        }
+
+        //hand the finished columns over, and give those lanes new ones
+        rays.resolve(scene, height, laneDrawStart, laneDrawEnd, laneColor, laneIndex, laneSteps);
+        int refillLanes = 0;
+        for (int lane = 0; lane < laneCount; ++lane) {
+            if (!(hitLanes & (1 << lane))) {
+                continue;
+            }
+
+            ColumnHit& column = columns[static_cast<int>(laneColumn[lane]) - startX];
+            column.drawStart = laneDrawStart[lane];
+            column.drawEnd = laneDrawEnd[lane];
+            column.color = laneColor[lane];
+            column.paletteIndex = laneIndex[lane];
+            column.steps = laneSteps[lane];
+
+            if (nextX < endX) {
+                laneColumn[lane] = static_cast<float>(nextX++);
+                refillLanes |= 1 << lane;
+            }
+            else {
+                idleLanes |= 1 << lane;
+            }
+        }
+
+        if (refillLanes) {
+            PacketRays<Lanes, Shape> fresh;
+            fresh.aim(scene, Lanes::load(laneColumn), width);
+            rays.replace(Lanes::from_bits(refillLanes), fresh);
+        }
+    }
+}
\ No newline at end of file
@@ -0,0 +1,101 @@
+#include "simd_raycast.h"
+
+//everything from here on may use SSE4.1, and is only called once
+//the cpu is known to have it
+#if defined(__clang__)
+#pragma clang attribute push (__attribute__((target("sse4.1"))), apply_to = function)
+#elif defined(__GNUC__)
+#pragma GCC push_options
+#pragma GCC target("sse4.1")
+#endif
+
+#include "simd_raycast_kernel.h"
+#include "simd_raycast_fixed.h"
+
+struct Sse41Lanes {
+    static const int width = 4;
+    typedef __m128 Float;
+    typedef __m128i Int;
+    typedef __m128 Mask;
+
+    static Float set(float value) { return _mm_set1_ps(value); }
+    static Float iota() { return _mm_setr_ps(0, 1, 2, 3); }
+    static Float load(const float* in) { return _mm_load_ps(in); }
+    static void store(float* out, Float a) { _mm_store_ps(out, a); }
+    static Int load_int(const int* in) { return _mm_load_si128((const __m128i*)in); }
+    static void store_int(int* out, Int a) { _mm_store_si128((__m128i*)out, a); }
+
+    static Float add(Float a, Float b) { return _mm_add_ps(a, b); }
+    static Float sub(Float a, Float b) { return _mm_sub_ps(a, b); }
+    static Float mul(Float a, Float b) { return _mm_mul_ps(a, b); }
+    static Float div(Float a, Float b) { return _mm_div_ps(a, b); }
+    static Float fmadd(Float a, Float b, Float c) { return _mm_add_ps(_mm_mul_ps(a, b), c); }
+    static Float abs(Float a) { return _mm_andnot_ps(_mm_set1_ps(-0.0f), a); }
+    static Float min(Float a, Float b) { return _mm_min_ps(a, b); }
+    static Float max(Float a, Float b) { return _mm_max_ps(a, b); }
+
+    static Mask less(Float a, Float b) { return _mm_cmplt_ps(a, b); }
+    static Mask equal(Float a, Float b) { return _mm_cmpeq_ps(a, b); }
+    static bool all(Mask mask) { return _mm_movemask_ps(mask) == 0xf; }
+    static Mask either(Mask a, Mask b) { return _mm_or_ps(a, b); }
+    static int bits(Mask mask) { return _mm_movemask_ps(mask); }
+    static Mask from_bits(int bits) {
+        __m128i laneBits = _mm_setr_epi32(1, 2, 4, 8);
+        return _mm_castsi128_ps(_mm_cmpeq_epi32(_mm_and_si128(_mm_set1_epi32(bits), laneBits), laneBits));
+    }
+    static Float select(Mask mask, Float a, Float b) { return _mm_blendv_ps(b, a, mask); }
+    static Float floor(Float a) { return _mm_floor_ps(a); }
+    static Int truncate(Float a) { return _mm_cvttps_epi32(a); }
+    static Float convert(Int a) { return _mm_cvtepi32_ps(a); }
+
+    //no gather instruction before AVX2, but the lanes still never leave
+    //registers for memory
+    static Int gather(const int* base, Int index) {
+        return _mm_setr_epi32(base[_mm_cvtsi128_si32(index)], base[_mm_extract_epi32(index, 1)],
+            base[_mm_extract_epi32(index, 2)], base[_mm_extract_epi32(index, 3)]);
+    }
+    static Int gather_byte(const uint8_t* base, Int index) {
+        return _mm_setr_epi32(base[_mm_cvtsi128_si32(index)], base[_mm_extract_epi32(index, 1)],
+            base[_mm_extract_epi32(index, 2)], base[_mm_extract_epi32(index, 3)]);
+    }
+    static Mask is_zero(Int a) { return _mm_castsi128_ps(_mm_cmpeq_epi32(a, _mm_setzero_si128())); }
+    static Mask less_int(Int a, Int b) { return _mm_castsi128_ps(_mm_cmplt_epi32(a, b)); }
+    static Int set_int(int value) { return _mm_set1_epi32(value); }
+    static Int add_int(Int a, Int b) { return _mm_add_epi32(a, b); }
+    static Int mul_int(Int a, Int b) { return _mm_mullo_epi32(a, b); }
+    static Int and_int(Int a, Int b) { return _mm_and_si128(a, b); }
+    static Int or_int(Int a, Int b) { return _mm_or_si128(a, b); }
+    static Int shift_left(Int a, int count) { return _mm_slli_epi32(a, count); }
+    static Int shift_right(Int a, int count) { return _mm_srai_epi32(a, count); }
+    static Int select_int(Mask mask, Int a, Int b) { return _mm_blendv_epi8(b, a, _mm_castps_si128(mask)); }
+};
+
+void simd_raycast::cast_packet_sse41(Scene* scene, int x, int width, int height, ColumnHit* hits) {
+    with_map_shape(scene->map, [&](auto shape) {
+        cast_packet<Sse41Lanes, decltype(shape)>(scene, x, width, height, hits);
+    });
+}
+
+void simd_raycast::cast_stream_sse41(Scene* scene, int startX, int endX, int width, int height, ColumnHit* columns) {
+    with_map_shape(scene->map, [&](auto shape) {
+        cast_stream<Sse41Lanes, decltype(shape)>(scene, startX, endX, width, height, columns);
+    });
+}
+
+void simd_raycast::cast_packet_fixed_sse41(Scene* scene, int x, int width, int height, ColumnHit* hits) {
+    with_map_shape(scene->map, [&](auto shape) {
+        cast_packet_fixed<Sse41Lanes, decltype(shape)>(scene, x, width, height, hits);
+    });
+}
+
+void simd_raycast::cast_stream_fixed_sse41(Scene* scene, int startX, int endX, int width, int height, ColumnHit* columns) {
+    with_map_shape(scene->map, [&](auto shape) {
+        cast_stream_fixed<Sse41Lanes, decltype(shape)>(scene, startX, endX, width, height, columns);
+    });
+}
+
+#if defined(__clang__)
+#pragma clang attribute pop
+#elif defined(__GNUC__)
+#pragma GCC pop_options
+#endif
\ No newline at end of file
@@ -0,0 +1,62 @@
+#include "simd_rays_backend.h"
+
+SimdRaysBackend::SimdRaysBackend(SimdIsa isa, bool streaming) {
+    kernel = simd_raycast::kernel(isa);
+    this->streaming = streaming;
+    drawAvx2 = simd::supported(SimdIsa::AVX2);
+}
+
+void SimdRaysBackend::set_precision(DdaPrecision precision) {
+    Backend::set_precision(precision);
+    kernel = simd_raycast::kernel(kernel.isa, precision);
+}
+
+void SimdRaysBackend::render(Scene* scene, Framebuffer& framebuffer, FrameTimer& timings) {
+
+    if (streaming) {
+        render_stream(scene, framebuffer, timings);
+    }
+    else {
+        render_packets(scene, framebuffer, timings);
+    }
+    drawing::finish_columns(framebuffer);
+}
+
+void SimdRaysBackend::render_packets(Scene* scene, Framebuffer& framebuffer, FrameTimer& timings) {
+
+    const int width = framebuffer.width;
+    const int height = framebuffer.height;
+
+    //the last packet can hang off the edge of the screen, so there's
+    //room for a whole one past it
+    columns.resize(width + simd_raycast::maxWidth);
+
+    //cast every packet, then draw them all, so each phase is timed once
+    timings.begin(FramePhase::CAST);
+    for (int x = 0; x < width; x += kernel.width) {
+        kernel.cast(scene, x, width, height, columns.data() + x);
+    }
+    timings.end(FramePhase::CAST);
+
+    timings.begin(FramePhase::DRAW);
+    for (int x = 0; x < width; ++x) {
+        drawing::draw_column(framebuffer, x, columns[x], drawAvx2);
+    }
+    timings.end(FramePhase::DRAW);
+}
+
+void SimdRaysBackend::render_stream(Scene* scene, Framebuffer& framebuffer, FrameTimer& timings) {
+
+    const int width = framebuffer.width;
+    columns.resize(width);
+
+    timings.begin(FramePhase::CAST);
+    kernel.stream(scene, 0, width, width, framebuffer.height, columns.data());
+    timings.end(FramePhase::CAST);
+
+    timings.begin(FramePhase::DRAW);
+    for (int x = 0; x < width; ++x) {
+        drawing::draw_column(framebuffer, x, columns[x], drawAvx2);
+    }
+    timings.end(FramePhase::DRAW);
+}
\ No newline at end of file
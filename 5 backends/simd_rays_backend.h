@@ -0,0 +1,30 @@
+#pragma once
+#include "backend.h"
+#include "simd_raycast.h"
+
+/*
+	Casts a packet of neighbouring columns at once, as many as the widest
+	vector unit on this machine holds.
+
+	Packets either start together and wait for their longest ray, or, when
+	streaming, refill a lane with the next column as soon as its ray hits,
+	and only drain at the end of the frame.
+*/
+class SimdRaysBackend : public Backend {
+public:
+	SimdRaysBackend(SimdIsa isa, bool streaming);
+	void render(Scene* scene, Framebuffer& framebuffer, FrameTimer& timings) override;
+	void set_precision(DdaPrecision precision) override;
+
+	PacketKernel kernel;
+
+private:
+	void render_packets(Scene* scene, Framebuffer& framebuffer, FrameTimer& timings);
+	void render_stream(Scene* scene, Framebuffer& framebuffer, FrameTimer& timings);
+
+	bool streaming;
+	bool drawAvx2;
+
+	//the whole frame is cast before anything is drawn
+	std::vector<ColumnHit> columns;
+};
\ No newline at end of file
@@ -0,0 +1,173 @@
+#include "taskflow_backend.h"
+#include "raycast.h"
+#include <taskflow/algorithm/for_each.hpp>
+#include <algorithm>
+
+TaskflowBackend::TaskflowBackend() {
+    drawAvx2 = simd::supported(SimdIsa::AVX2);
+    executor = std::make_unique<tf::Executor>();
+}
+
+void TaskflowBackend::set_oversubscription(int slicesPerWorker) {
+    oversubscription = std::max(1, slicesPerWorker);
+    //rebuild on the next frame
+    graphWidth = 0;
+}
+
+void TaskflowBackend::set_workers(unsigned workerCount) {
+    executor = std::make_unique<tf::Executor>(std::max(1u, workerCount));
+}
+
+void TaskflowBackend::render(Scene* scene, Framebuffer& framebuffer, FrameTimer& timings) {
+
+    this->scene = scene;
+    this->framebuffer = &framebuffer;
+    if (graphWidth != static_cast<int>(framebuffer.width)
+        || graphWorkers != executor->num_workers()) {
+        work.clear();
+        graphWidth = framebuffer.width;
+        graphWorkers = executor->num_workers();
+        columnSteps.assign(graphWidth, 0);
+        columns.resize(graphWidth);
+        create_task_graph(graphWidth);
+    }
+
+    castNanoseconds = 0;
+    drawNanoseconds = 0;
+    executor->run(work).wait();
+    timings.record(FramePhase::CAST, castNanoseconds * 1e-6);
+    timings.record(FramePhase::DRAW, drawNanoseconds * 1e-6);
+
+    end_frame();
+}
+
+void TaskflowBackend::render_region(int startX, int batchSize) {
+
+    int endX = std::min(startX + batchSize, graphWidth);
+    if (startX >= endX) {
+        return;
+    }
+
+    //cast the whole slice, then draw it, so each phase is timed once
+    auto start = FrameTimer::now();
+    ColumnCaster cast_column = raycast::caster(precision);
+    for (int x = startX; x < endX; ++x) {
+        columns[x] = cast_column(scene, x, framebuffer->width, framebuffer->height);
+    }
+    draw_region(startX, endX, start);
+}
+
+void TaskflowBackend::draw_region(int startX, int endX, std::chrono::high_resolution_clock::time_point start) {
+
+    auto castDone = FrameTimer::now();
+    for (int x = startX; x < endX; ++x) {
+        drawing::draw_column(*framebuffer, x, columns[x], drawAvx2);
+        columnSteps[x] = columns[x].steps;
+    }
+    drawing::finish_columns(*framebuffer);
+    auto drawDone = FrameTimer::now();
+
+    castNanoseconds += static_cast<long long>(FrameTimer::milliseconds(start, castDone) * 1e6);
+    drawNanoseconds += static_cast<long long>(FrameTimer::milliseconds(castDone, drawDone) * 1e6);
+}
+
+void TaskflowBackend::create_slices(int width, int sliceCount, int alignment) {
+
+    //equally wide to start with, until there's a frame to learn from
+    sliceAlignment = alignment;
+    int groupCount = (width + alignment - 1) / alignment;
+    sliceStart.resize(sliceCount + 1);
+    for (int slice = 0; slice <= sliceCount; ++slice) {
+        sliceStart[slice] = std::min(width, (groupCount * slice + sliceCount - 1) / sliceCount * alignment);
+    }
+
+    //tasks look their slice up when they run, so it can move between frames
+    for (int slice = 0; slice < sliceCount; ++slice) {
+        work.emplace([this, slice]() {render_region(sliceStart[slice], sliceStart[slice + 1] - sliceStart[slice]); });
+    }
+}
+
+int TaskflowBackend::slice_count(int width, int alignment) const {
+
+    //a slice narrower than this spends more on scheduling than on rays
+    const int minSliceWidth = 32;
+    int groupWidth = (minSliceWidth + alignment - 1) / alignment * alignment;
+    int widest = std::max(1, width / groupWidth);
+    int wanted = static_cast<int>(graphWorkers) * oversubscription;
+    return std::clamp(wanted, 1, widest);
+}
+
+void TaskflowBackend::balance_slices() {
+
+    //every column costs its steps, plus a little for setting up and
+    //drawing the ray, so columns facing a wall aren't free
+    const int columnOverhead = 4;
+    long long totalCost = 0;
+    for (int steps : columnSteps) {
+        totalCost += steps + columnOverhead;
+    }
+
+    //each boundary goes where the running cost passes its share
+    int sliceCount = static_cast<int>(sliceStart.size()) - 1;
+    int slice = 1;
+    long long cost = 0;
+    for (int x = 0; x < graphWidth && slice < sliceCount; x += sliceAlignment) {
+        while (slice < sliceCount && cost * sliceCount >= totalCost * slice) {
+            sliceStart[slice++] = x;
+        }
+        for (int column = x; column < std::min(x + sliceAlignment, graphWidth); ++column) {
+            cost += columnSteps[column] + columnOverhead;
+        }
+    }
+    while (slice < sliceCount) {
+        sliceStart[slice++] = graphWidth;
+    }
+}
+
+void BatchedBackend::create_task_graph(int width) {
+
+    create_slices(width, slice_count(width, 1), 1);
+}
+
+void BatchedBackend::end_frame() {
+    balance_slices();
+}
+
+void ParallelForBackend::create_task_graph(int width) {
+
+    //each task reads the clock and adds to the frame's times once a
+    //chunk, not once a column
+    int chunkCount = slice_count(width, 1);
+    int chunkWidth = (width + chunkCount - 1) / chunkCount;
+    work.for_each_index(0, width, chunkWidth, [this, chunkWidth](int x) {render_region(x, chunkWidth); });
+}
+HybridBackend::HybridBackend(SimdIsa isa) {
+    kernel = simd_raycast::kernel(isa);
+}
+
+void HybridBackend::set_precision(DdaPrecision precision) {
+    TaskflowBackend::set_precision(precision);
+    kernel = simd_raycast::kernel(kernel.isa, precision);
+}
+
+void HybridBackend::create_task_graph(int width) {
+
+    //each slice a whole number of packets wide
+    create_slices(width, slice_count(width, kernel.width), kernel.width);
+}
+
+void HybridBackend::end_frame() {
+    balance_slices();
+}
+
+void HybridBackend::render_region(int startX, int batchSize) {
+
+    int endX = std::min(startX + batchSize, graphWidth);
+    if (startX >= endX) {
+        return;
+    }
+
+    auto start = FrameTimer::now();
+    kernel.stream(scene, startX, endX, framebuffer->width, framebuffer->height, columns.data() + startX);
+    draw_region(startX, endX, start);
+}
\ No newline at end of file
@@ -0,0 +1,98 @@
+#pragma once
+#include "backend.h"
+#include "simd_raycast.h"
+#include <taskflow/taskflow.hpp>
+#include <memory>
+
+/*
+	Splits the screen into regions of columns and renders them on a
+	taskflow executor. Subclasses decide how the regions are cut.
+
+	Slices can follow the cost of the previous frame: every column records
+	how many DDA steps its ray took, and the slice boundaries move so each
+	slice gets the same share of steps. Neighbouring frames look alike, so
+	that's a good guess for the next one.
+
+	How many slices there are follows the hardware: a few per worker
+	thread, so a slow slice doesn't leave the others idle, but never so
+	narrow that scheduling costs more than the columns.
+*/
+class TaskflowBackend : public Backend {
+public:
+	TaskflowBackend();
+	void render(Scene* scene, Framebuffer& framebuffer, FrameTimer& timings) override;
+	virtual void render_region(int startX, int batchSize);
+
+	//slices per worker thread
+	void set_oversubscription(int slicesPerWorker);
+	//swaps in an executor with this many worker threads
+	void set_workers(unsigned workerCount);
+
+protected:
+	virtual void create_task_graph(int width) = 0;
+	//called once the frame's tasks have all finished
+	virtual void end_frame() {}
+	//draw the columns from startX up to endX, cast since start, and add
+	//both phases to the frame's times
+	void draw_region(int startX, int endX, std::chrono::high_resolution_clock::time_point start);
+
+	//sliceCount tasks, each rendering from sliceStart[slice] up to
+	//sliceStart[slice + 1]. Boundaries are multiples of alignment.
+	void create_slices(int width, int sliceCount, int alignment);
+	int slice_count(int width, int alignment) const;
+	void balance_slices();
+
+	//what the tasks draw this frame
+	Scene* scene = nullptr;
+	Framebuffer* framebuffer = nullptr;
+
+	//the graph is built for one screen width and worker count
+	int graphWidth = 0;
+	size_t graphWorkers = 0;
+	int oversubscription = 4;
+
+	bool drawAvx2;
+
+	//written by whichever task renders the column
+	std::vector<int> columnSteps;
+	//each task casts its slice in here before drawing it
+	std::vector<ColumnHit> columns;
+	std::vector<int> sliceStart;
+	int sliceAlignment = 1;
+
+	//cast and draw time summed over every worker, so together they can
+	//exceed the wall time of the frame
+	std::atomic<long long> castNanoseconds, drawNanoseconds;
+
+	std::unique_ptr<tf::Executor> executor;
+	tf::Taskflow work;
+};
+
+//A fixed number of slices, balanced by cost
+class BatchedBackend : public TaskflowBackend {
+protected:
+	void create_task_graph(int width) override;
+	void end_frame() override;
+};
+
+//Equal chunks of columns, as many as there would be slices, left for
+//taskflow's parallel for to schedule
+class ParallelForBackend : public TaskflowBackend {
+protected:
+	void create_task_graph(int width) override;
+};
+
+//Slices like BatchedBackend, but each task streams ray packets
+//across its slice, so every core's vector units are busy
+class HybridBackend : public TaskflowBackend {
+public:
+	HybridBackend(SimdIsa isa);
+	void render_region(int startX, int batchSize) override;
+	void set_precision(DdaPrecision precision) override;
+
+	PacketKernel kernel;
+
+protected:
+	void create_task_graph(int width) override;
+	void end_frame() override;
+};
\ No newline at end of file